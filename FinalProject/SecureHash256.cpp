@@ -0,0 +1,180 @@
+#include "SecureHash256.h"
+#include "Instrumentation.h"
+
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+std::vector<std::vector<SecureHash256::HashWord>> SecureHash256::prepareMessage(const unsigned char* input, size_t inputLength) {
+    // Calculate required padding
+    size_t bitLength = inputLength * 8;
+    size_t paddingBits = (448 - 1 - bitLength) % 512;
+    if (paddingBits < 0) paddingBits += 512; // Ensure positive value
+    
+    // Calculate total number of blocks needed
+    size_t blockCount = (bitLength + 1 + paddingBits + 64) / 512;
+    
+    // Create blocks with exact required size
+    std::vector<std::vector<HashWord>> blocks(blockCount, std::vector<HashWord>(BLOCK_SEQUENCE_LEN, 0));
+    
+    // Fill blocks with message data
+    size_t byteIndex = 0;
+    for (size_t blockIdx = 0; blockIdx < blockCount; blockIdx++) {
+        for (size_t wordIdx = 0; wordIdx < BLOCK_SEQUENCE_LEN; wordIdx++) {
+            HashWord word = 0;
+            for (size_t byteOffset = 0; byteOffset < 4; byteOffset++) {
+                // Current byte position in the overall message
+                size_t pos = blockIdx * 64 + wordIdx * 4 + byteOffset;
+                
+                if (pos < inputLength) {
+                    // Normal byte from input
+                    word = (word << 8) | input[pos];
+                } else if (pos == inputLength) {
+                    // Padding begins with a bit 1
+                    word = (word << 8) | 0x80;
+                } else {
+                    // Continue with padding bits (zeros)
+                    word = (word << 8);
+                }
+            }
+            blocks[blockIdx][wordIdx] = word;
+        }
+    }
+    
+    // Append original message length as 64-bit big-endian integer
+    // For messages < 2^32 bits, we only need to set the low-order word
+    if (bitLength < 0x100000000) {
+        blocks[blockCount-1][14] = 0;
+        blocks[blockCount-1][15] = static_cast<HashWord>(bitLength);
+    } else {
+        // Handle larger messages (rarely needed for typical use)
+        uint64_t length64 = bitLength;
+        blocks[blockCount-1][14] = static_cast<HashWord>(length64 >> 32);
+        blocks[blockCount-1][15] = static_cast<HashWord>(length64 & 0xFFFFFFFF);
+    }
+    
+    return blocks;
+}
+
+void SecureHash256::processBlocks(const std::vector<std::vector<HashWord>>& blocks, HashWord* hashValues) {
+    INSTRUMENT_SCOPE("SecureHash256::processBlocks");
+    INSTRUMENT_COUNT(Sha256BlockCompressed, blocks.size());
+    // Initialize hash values with initial state
+    std::memcpy(hashValues, initialStates, HASH_ARRAY_LEN * sizeof(HashWord));
+    
+    // Temporary variables for calculations
+    HashWord a, b, c, d, e, f, g, h, temp1, temp2;
+    HashWord schedule[SCHEDULE_ARRAY_LEN];
+    
+    // Process each message block
+    for (const auto& block : blocks) {
+        // Copy the first 16 words from the block to the schedule
+        std::copy(block.begin(), block.end(), schedule);
+        
+        // Extend the schedule to 64 words
+        for (size_t t = 16; t < SCHEDULE_ARRAY_LEN; t++) {
+            schedule[t] = schedule[t-16] + 
+                          LOWERCASE_SIGMA0(schedule[t-15]) + 
+                          schedule[t-7] + 
+                          LOWERCASE_SIGMA1(schedule[t-2]);
+        }
+        
+        // Initialize working variables with current hash value
+        a = hashValues[0];
+        b = hashValues[1];
+        c = hashValues[2];
+        d = hashValues[3];
+        e = hashValues[4];
+        f = hashValues[5];
+        g = hashValues[6];
+        h = hashValues[7];
+        
+        // Main compression loop
+        for (size_t t = 0; t < SCHEDULE_ARRAY_LEN; t++) {
+            temp1 = h + SIGMA1(e) + CHOOSE(e, f, g) + roundConstants[t] + schedule[t];
+            temp2 = SIGMA0(a) + MAJORITY(a, b, c);
+            
+            h = g;
+            g = f;
+            f = e;
+            e = d + temp1;
+            d = c;
+            c = b;
+            b = a;
+            a = temp1 + temp2;
+        }
+        
+        // Update hash values for this block
+        hashValues[0] += a;
+        hashValues[1] += b;
+        hashValues[2] += c;
+        hashValues[3] += d;
+        hashValues[4] += e;
+        hashValues[5] += f;
+        hashValues[6] += g;
+        hashValues[7] += h;
+    }
+}
+
+std::string SecureHash256::generateDigest(const HashWord* hashValues) {
+    std::stringstream ss;
+    for (size_t i = 0; i < HASH_ARRAY_LEN; i++) {
+        ss << std::hex << std::setw(8) << std::setfill('0') << hashValues[i];
+    }
+    return ss.str();
+}
+
+std::string SecureHash256::calculateHash(const std::string& input) {
+    return calculateHash(reinterpret_cast<const unsigned char*>(input.data()), input.length());
+}
+
+std::string SecureHash256::calculateHash(const unsigned char* input, size_t length) {
+    if (!input && length > 0) {
+        throw std::invalid_argument("Invalid input: null pointer with non-zero length");
+    }
+    
+    // Prepare message blocks
+    auto blocks = prepareMessage(input, length);
+    
+    // Process blocks and generate hash
+    HashWord hashValues[HASH_ARRAY_LEN];
+    processBlocks(blocks, hashValues);
+    
+    // Convert hash to string and return
+    return generateDigest(hashValues);
+}
+
+std::string SecureHash256::calculateFileHash(const std::string& filePath) {
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot open file: " + filePath);
+    }
+    
+    // Read file contents
+    std::vector<unsigned char> buffer(
+        (std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>()
+    );
+    
+    file.close();
+    
+    // Calculate hash for file contents
+    return calculateHash(buffer.data(), buffer.size());
+}
+
+std::string SecureHash256::hash(const std::string& input) {
+    SecureHash256 hasher;
+    return hasher.calculateHash(input);
+}
+
+std::string SecureHash256::hashFile(const std::string& filePath) {
+    SecureHash256 hasher;
+    return hasher.calculateFileHash(filePath);
+}
@@ -0,0 +1,93 @@
+#ifndef SECURE_HASH_256_H
+#define SECURE_HASH_256_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class SecureHash256 {
+private:
+    using HashWord = uint32_t;
+    
+    // Initial hash values (first 32 bits of the fractional parts of the square roots of the first 8 primes 2..19)
+    const HashWord initialStates[8] = {
+        0x6a09e667u, 0xbb67ae85u, 0x3c6ef372u, 0xa54ff53au,
+        0x510e527fu, 0x9b05688cu, 0x1f83d9abu, 0x5be0cd19u
+    };
+
+    // Round constants (first 32 bits of the fractional parts of the cube roots of the first 64 primes 2..311)
+    const HashWord roundConstants[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    };
+
+    // Core operations
+    inline HashWord CHOOSE(HashWord x, HashWord y, HashWord z) const {
+        return (x & y) ^ (~x & z);
+    }
+    
+    inline HashWord MAJORITY(HashWord x, HashWord y, HashWord z) const {
+        return (x & y) ^ (x & z) ^ (y & z);
+    }
+    
+    inline HashWord ROTATE_RIGHT(HashWord x, unsigned int n) const {
+        return (x >> n) | (x << (32 - n));
+    }
+    
+    inline HashWord SIGMA0(HashWord x) const {
+        return ROTATE_RIGHT(x, 2) ^ ROTATE_RIGHT(x, 13) ^ ROTATE_RIGHT(x, 22);
+    }
+    
+    inline HashWord SIGMA1(HashWord x) const {
+        return ROTATE_RIGHT(x, 6) ^ ROTATE_RIGHT(x, 11) ^ ROTATE_RIGHT(x, 25);
+    }
+    
+    inline HashWord LOWERCASE_SIGMA0(HashWord x) const {
+        return ROTATE_RIGHT(x, 7) ^ ROTATE_RIGHT(x, 18) ^ (x >> 3);
+    }
+    
+    inline HashWord LOWERCASE_SIGMA1(HashWord x) const {
+        return ROTATE_RIGHT(x, 17) ^ ROTATE_RIGHT(x, 19) ^ (x >> 10);
+    }
+
+    // Constants
+    static const size_t BLOCK_SEQUENCE_LEN = 16;
+    static const size_t HASH_ARRAY_LEN = 8;
+    static const size_t SCHEDULE_ARRAY_LEN = 64;
+    static const size_t BLOCK_SIZE = 512;
+    static const size_t WORD_SIZE = 4; // 32 bits = 4 bytes
+
+    // Prepare message blocks from input data
+    std::vector<std::vector<HashWord>> prepareMessage(const unsigned char* input, size_t inputLength);
+
+    // Process all message blocks and compute the hash value
+    void processBlocks(const std::vector<std::vector<HashWord>>& blocks, HashWord* hashValues);
+
+    // Generate final digest string from hash values
+    std::string generateDigest(const HashWord* hashValues);
+
+public:
+    // Calculate hash for a string input
+    std::string calculateHash(const std::string& input);
+    
+    // Calculate hash for binary data with specific length
+    std::string calculateHash(const unsigned char* input, size_t length);
+    
+    // Calculate hash for file contents
+    std::string calculateFileHash(const std::string& filePath);
+    
+    // Utility function for direct string hashing
+    static std::string hash(const std::string& input);
+    
+    // Utility function for direct file hashing
+    static std::string hashFile(const std::string& filePath);
+};
+
+#endif  // SECURE_HASH_256_H
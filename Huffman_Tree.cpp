@@ -1,67 +1,12 @@
 #include <iostream>
-#include <queue>
+#include <algorithm>
 #include <unordered_map>
+#include <utility>
 #include <vector>
-#include <sstream>
-#include <algorithm>
 #include <limits>
+#include "Huffman_Codes.h"
 using namespace std;
 
-struct HuffmanTreeNode {
-    char character;
-    int frequency;
-    HuffmanTreeNode *left, *right;
-    
-    HuffmanTreeNode(char c, int f) : character(c), frequency(f), left(nullptr), right(nullptr) {}
-};
-
-struct CompareNodes {
-    bool operator()(HuffmanTreeNode* a, HuffmanTreeNode* b) {
-        return a->frequency > b->frequency;
-    }
-};
-
-void generateHuffmanCodes(HuffmanTreeNode* root, string code, unordered_map<char, string>& huffmanMap) {
-    if (!root) return;
-    if (!root->left && !root->right) {
-        huffmanMap[root->character] = code;
-    }
-    generateHuffmanCodes(root->left, code + "0", huffmanMap);
-    generateHuffmanCodes(root->right, code + "1", huffmanMap);
-}
-
-unordered_map<char, string> buildHuffmanTree(const string& symbols, const vector<int>& frequencies) {
-    priority_queue<HuffmanTreeNode*, vector<HuffmanTreeNode*>, CompareNodes> minHeap;
-    for (size_t i = 0; i < symbols.size(); ++i) {
-        minHeap.push(new HuffmanTreeNode(symbols[i], frequencies[i]));
-    }
-    while (minHeap.size() > 1) {
-        HuffmanTreeNode *left = minHeap.top(); minHeap.pop();
-        HuffmanTreeNode *right = minHeap.top(); minHeap.pop();
-        HuffmanTreeNode *parent = new HuffmanTreeNode('#', left->frequency + right->frequency);
-        parent->left = left;
-        parent->right = right;
-        minHeap.push(parent);
-    }
-    unordered_map<char, string> huffmanMap;
-    generateHuffmanCodes(minHeap.top(), "", huffmanMap);
-    return huffmanMap;
-}
-
-bool isValidCharacterSet(const string& input) {
-    return all_of(input.begin(), input.end(), [](char ch) { return isalpha(ch); });
-}
-
-bool isValidFrequencyInput(const string& input, vector<int>& frequencyList, size_t expectedSize) {
-    frequencyList.clear();
-    stringstream freqStream(input);
-    int freq;
-    while (freqStream >> freq) {
-        frequencyList.push_back(freq);
-    }
-    return frequencyList.size() == expectedSize;
-}
-
 int main() {
     string characterSet;
     vector<int> frequencies;
@@ -89,20 +34,10 @@ int main() {
     
     unordered_map<char, string> huffmanCodes = buildHuffmanTree(characterSet, frequencies);
     cout << "Huffman Codes in Preorder Traversal:\n";
-    priority_queue<HuffmanTreeNode*, vector<HuffmanTreeNode*>, CompareNodes> minHeap;
-    for (size_t i = 0; i < characterSet.size(); ++i) {
-        minHeap.push(new HuffmanTreeNode(characterSet[i], frequencies[i]));
-    }
-    while (minHeap.size() > 1) {
-        HuffmanTreeNode *left = minHeap.top(); minHeap.pop();
-        HuffmanTreeNode *right = minHeap.top(); minHeap.pop();
-        HuffmanTreeNode *parent = new HuffmanTreeNode('#', left->frequency + right->frequency);
-        parent->left = left;
-        parent->right = right;
-        minHeap.push(parent);
-    }
-    HuffmanTreeNode* root = minHeap.top();
-    for (const auto& pair : huffmanCodes) {
+    // Leaves are visited in preorder exactly when their codes are in lexicographic order
+    vector<pair<char, string>> codes(huffmanCodes.begin(), huffmanCodes.end());
+    sort(codes.begin(), codes.end(), [](const auto& a, const auto& b) { return a.second < b.second; });
+    for (const auto& pair : codes) {
         cout << "  " << pair.first << " : " << pair.second << endl;
     }
     return 0;
@@ -1,53 +1,9 @@
 #include <iostream>
 #include <vector>
-#include <unordered_map>
-#include <sstream>
-#include <limits>
-#include <regex>
+#include "Two_Sum.h"
 
 using namespace std;
 
-pair<int, int> twoSum(const vector<int>& arr, int target) {
-    unordered_map<int, int> lookup;
-    for (int i = 0; i < arr.size(); ++i) {
-        int complement = target - arr[i];
-        if (lookup.find(complement) != lookup.end()) {
-            return {lookup[complement], i};
-        }
-        lookup[arr[i]] = i;
-    }
-    return {-1, -1}; 
-}
-
-// Improved regex to allow both space and comma as separators
-bool isValidInput(const string& input) {
-    regex pattern(R"(^\s*-?\d+(\s*[, ]\s*-?\d+)*\s*$)"); 
-    return regex_match(input, pattern);
-}
-
-vector<int> parseInput(const string& input) {
-    vector<int> result;
-    string cleanedInput;
-    
-    // Replace commas with spaces to standardize input
-    for (char c : input) {
-        if (c == ',') {
-            cleanedInput += ' ';
-        } else {
-            cleanedInput += c;
-        }
-    }
-
-    stringstream ss(cleanedInput);
-    int num;
-    
-    while (ss >> num) {
-        result.push_back(num);
-    }
-    
-    return result;
-}
-
 int main() {
     string input;
     int target;
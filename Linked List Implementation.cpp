@@ -1,66 +1,25 @@
 #include <iostream>
 #include <vector>
+#include "Sparse_Linked_List.h"
 using namespace std;
 
-struct Node {
-    int row;
-    int col;
-    int value;
-    Node* next;
-
-    Node(int r, int c, int v) : row(r), col(c), value(v), next(nullptr) {}
-};
-
-class SparseMatrix {
-private:
-    Node* head;
-
-public:
-    SparseMatrix() : head(nullptr) {}
-
-    void addElement(int row, int col, int value) {
-        Node* newNode = new Node(row, col, value);
-        if (!head) {
-            head = newNode;
-        } else {
-            Node* temp = head;
-            while (temp->next) {
-                temp = temp->next;
-            }
-            temp->next = newNode;
-        }
-    }
-
-    void display() {
-        Node* temp = head;
-        while (temp) {
-            cout << "(" << temp->row << ", " << temp->col << ", " << temp->value << ") -> ";
-            temp = temp->next;
+int main(int argc, char* argv[]) {
+    // With a .mtx or triplet file (and optional binary cache path) the dense matrix is never built
+    if (argc > 1) {
+        try {
+            SparseTriplets triplets = loadSparseMatrix(argv[1], argc > 2 ? argv[2] : "");
+            // Sized up front so empty trailing rows and columns are kept
+            SparseMatrix sparseList(triplets.rows, triplets.cols);
+            convertToLinkedList(triplets, sparseList);
+            cout << "Linked list representation of the sparse matrix:" << endl;
+            sparseList.display();
+        } catch (const exception& e) {
+            cerr << "Error: " << e.what() << endl;
+            return 1;
         }
-        cout << "NULL" << endl;
+        return 0;
     }
 
-    ~SparseMatrix() {
-        Node* temp;
-        while (head) {
-            temp = head;
-            head = head->next;
-            delete temp;
-        }
-    }
-};
-
-void convertToLinkedList(const vector<vector<int>>& matrix, SparseMatrix& sparseList) {
-    for (int i = 0; i < matrix.size(); ++i) {
-        for (int j = 0; j < matrix[i].size(); ++j) {
-            if (matrix[i][j] != 0) {
-                sparseList.addElement(i, j, matrix[i][j]);
-            }
-        }
-    }
-}
-
-int main() {
     int rows, cols;
     cout << "Enter the number of rows and columns for the sparse matrix: ";
     cin >> rows >> cols;
@@ -82,7 +41,7 @@ int main() {
         cout << endl;
     }
 
-    SparseMatrix sparseList;
+    SparseMatrix sparseList(rows, cols);
     convertToLinkedList(matrix, sparseList);
 
     cout << "Linked list representation of the sparse matrix:" << endl;
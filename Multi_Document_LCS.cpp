@@ -0,0 +1,76 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <limits>
+#include "Suffix_Automaton.h"
+
+int main() {
+    std::string filePath;
+    std::cout << "Enter corpus file path (one document per line, e.g. FinalProject/input.txt): ";
+    std::cin >> filePath;
+
+    std::vector<std::string> documents;
+    try {
+        documents = readDocuments(filePath);
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    GeneralizedSuffixAutomaton automaton(documents);
+    std::cout << "Indexed " << automaton.documentCount() << " documents ("
+              << automaton.stateCount() << " automaton states).\n";
+
+    int option;
+    do {
+        std::cout << "\n=== Multi-Document Substring Search ===\n";
+        std::cout << "1. Longest substring shared by at least k documents\n";
+        std::cout << "2. Top repeated substrings\n";
+        std::cout << "3. Exit\n";
+        std::cout << "Choose an option: ";
+
+        if (!(std::cin >> option)) {
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            std::cerr << "Invalid input. Please enter a number.\n";
+            continue;
+        }
+
+        if (option == 1) {
+            int k;
+            std::cout << "Enter k: ";
+            if (!(std::cin >> k) || k < 1) {
+                std::cin.clear();
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                std::cout << "Error: k must be a positive integer.\n";
+                continue;
+            }
+            auto match = automaton.longestShared(k);
+            if (match.substring.empty()) {
+                std::cout << "No substring is shared by " << k << " documents.\n";
+            } else {
+                std::cout << "Longest Common Substring: \"" << match.substring << "\"\n";
+                std::cout << "Length: " << match.substring.size() << "\n";
+                std::cout << "Documents: " << match.documents << ", Occurrences: " << match.occurrences << "\n";
+            }
+        } else if (option == 2) {
+            size_t count;
+            int minLen;
+            std::cout << "Enter number of results and minimum length: ";
+            if (!(std::cin >> count >> minLen)) {
+                std::cin.clear();
+                std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+                std::cout << "Error: Please enter two integers.\n";
+                continue;
+            }
+            for (const auto& match : automaton.topRepeated(count, minLen)) {
+                std::cout << "  " << match.occurrences << "x in " << match.documents
+                          << " documents: \"" << match.substring << "\"\n";
+            }
+        } else if (option != 3) {
+            std::cout << "Invalid option. Please try again.\n";
+        }
+    } while (option != 3);
+
+    return 0;
+}
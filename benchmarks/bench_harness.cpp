@@ -0,0 +1,357 @@
+#include "bench_harness.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Every heap allocation in a benchmark executable goes through these
+// replacements, so the harness can report allocations per op.
+static std::atomic<uint64_t> allocationCount{0};
+static std::atomic<uint64_t> allocatedBytes{0};
+
+static void* countedAllocate(size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+static void* countedAllocate(size_t size, std::align_val_t alignment) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    size_t align = static_cast<size_t>(alignment);
+    size_t rounded = (size + align - 1) / align * align;
+    if (void* p = std::aligned_alloc(align, rounded ? rounded : align)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size) { return countedAllocate(size); }
+void* operator new[](size_t size) { return countedAllocate(size); }
+void* operator new(size_t size, std::align_val_t alignment) { return countedAllocate(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return countedAllocate(size, alignment); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace {
+
+struct BenchOptions {
+    double minTimeMs = 200.0;
+    std::string filter;
+    uint64_t seed = 42;
+    std::string outPath;
+    std::string baselinePath;
+    double thresholdPct = 10.0;
+};
+
+struct BenchResult {
+    std::string name;
+    std::string unit;
+    size_t size;
+    uint64_t iterations;
+    double nsPerOp;
+    double itemsPerSec;
+    double allocsPerOp;
+    double bytesPerOp;
+};
+
+struct BatchStats {
+    double seconds;
+    uint64_t allocations;
+    uint64_t bytes;
+};
+
+BatchStats timeBatch(const std::function<void()>& op, uint64_t iterations) {
+    uint64_t allocsBefore = allocationCount.load(std::memory_order_relaxed);
+    uint64_t bytesBefore = allocatedBytes.load(std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < iterations; i++) op();
+    auto stop = std::chrono::steady_clock::now();
+    return {std::chrono::duration<double>(stop - start).count(),
+            allocationCount.load(std::memory_order_relaxed) - allocsBefore,
+            allocatedBytes.load(std::memory_order_relaxed) - bytesBefore};
+}
+
+// Grow the batch until it fills a tenth of the budget, then take the fastest of three full batches
+BenchResult measure(const BenchCase& c, size_t size, const BenchOptions& options) {
+    std::mt19937_64 rng(options.seed ^ (std::hash<std::string>()(c.name) + size * 0x9E3779B97F4A7C15ull));
+    BenchRun run = c.prepare(size, rng);
+    run.op();
+
+    double budget = options.minTimeMs / 1000.0;
+    uint64_t iterations = 1;
+    BatchStats probe = timeBatch(run.op, iterations);
+    while (probe.seconds < budget / 10 && iterations < (1ull << 40)) {
+        iterations *= 2;
+        probe = timeBatch(run.op, iterations);
+    }
+    iterations = std::max<uint64_t>(1, static_cast<uint64_t>(budget / 3 / (probe.seconds / iterations)));
+
+    BatchStats best = timeBatch(run.op, iterations);
+    for (int rep = 1; rep < 3; rep++) {
+        BatchStats stats = timeBatch(run.op, iterations);
+        if (stats.seconds < best.seconds) best = stats;
+    }
+
+    BenchResult r;
+    r.name = c.name;
+    r.unit = c.unit;
+    r.size = size;
+    r.iterations = iterations;
+    r.nsPerOp = best.seconds * 1e9 / iterations;
+    r.itemsPerSec = run.itemsPerOp * iterations / best.seconds;
+    r.allocsPerOp = static_cast<double>(best.allocations) / iterations;
+    r.bytesPerOp = static_cast<double>(best.bytes) / iterations;
+    return r;
+}
+
+std::string optionValue(const std::string& arg, const std::string& key) {
+    return arg.compare(0, key.size(), key) == 0 ? arg.substr(key.size()) : std::string();
+}
+
+BenchOptions parseOptions(int argc, char* argv[]) {
+    BenchOptions options;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        std::string value;
+        if (arg == "--quick") {
+            options.minTimeMs = 20.0;
+        } else if (!(value = optionValue(arg, "--min-time=")).empty()) {
+            options.minTimeMs = std::stod(value);
+        } else if (!(value = optionValue(arg, "--filter=")).empty()) {
+            options.filter = value;
+        } else if (!(value = optionValue(arg, "--seed=")).empty()) {
+            options.seed = std::stoull(value);
+        } else if (!(value = optionValue(arg, "--out=")).empty()) {
+            options.outPath = value;
+        } else if (!(value = optionValue(arg, "--baseline=")).empty()) {
+            options.baselinePath = value;
+        } else if (!(value = optionValue(arg, "--threshold=")).empty()) {
+            options.thresholdPct = std::stod(value);
+        } else {
+            throw std::invalid_argument("Unknown option: " + arg);
+        }
+    }
+    return options;
+}
+
+std::string jsonEscape(const std::string& s) {
+    std::string out;
+    for (char ch : s) {
+        if (ch == '"' || ch == '\\') out += '\\';
+        out += ch;
+    }
+    return out;
+}
+
+#ifndef BENCH_NATIVE
+#define BENCH_NATIVE 0
+#endif
+#ifndef BENCH_INSTRUMENTATION
+#define BENCH_INSTRUMENTATION 0
+#endif
+#ifndef BENCH_BUILD_TYPE
+#define BENCH_BUILD_TYPE "unknown"
+#endif
+
+// Build settings that change timings; results are only comparable when these match
+std::string buildDescription() {
+    return std::string("{\"native\": ") + (BENCH_NATIVE ? "true" : "false") +
+           ", \"instrumentation\": " + (BENCH_INSTRUMENTATION ? "true" : "false") +
+           ", \"build_type\": \"" + jsonEscape(BENCH_BUILD_TYPE) + "\"}";
+}
+
+// One result object per line, so baselines can be read back line by line
+void writeJson(const std::string& path, const std::string& suite, const BenchOptions& options,
+               const std::vector<BenchResult>& results) {
+    std::ofstream file(path);
+    if (!file.is_open()) throw std::runtime_error("Cannot write file: " + path);
+    file.precision(6);
+    file << "{\n  \"suite\": \"" << jsonEscape(suite) << "\",\n  \"seed\": " << options.seed
+         << ",\n  \"build\": " << buildDescription() << ",\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& r = results[i];
+        file << "    {\"name\": \"" << jsonEscape(r.name) << "\", \"size\": " << r.size
+             << ", \"unit\": \"" << jsonEscape(r.unit) << "\", \"iterations\": " << r.iterations
+             << ", \"ns_per_op\": " << std::fixed << r.nsPerOp
+             << ", \"items_per_sec\": " << r.itemsPerSec
+             << ", \"allocs_per_op\": " << r.allocsPerOp
+             << ", \"bytes_per_op\": " << r.bytesPerOp << std::defaultfloat << "}"
+             << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    file << "  ]\n}\n";
+}
+
+bool extractField(const std::string& line, const std::string& key, std::string& value) {
+    std::string pattern = "\"" + key + "\": ";
+    size_t pos = line.find(pattern);
+    if (pos == std::string::npos) return false;
+    pos += pattern.size();
+    if (line[pos] == '"') {
+        size_t end = line.find('"', pos + 1);
+        value = line.substr(pos + 1, end - pos - 1);
+    } else {
+        size_t end = line.find_first_of(",}", pos);
+        value = line.substr(pos, end - pos);
+    }
+    return true;
+}
+
+// Baseline ns/op keyed by (name, size); build receives the baseline's build settings
+std::map<std::pair<std::string, size_t>, double> readBaseline(const std::string& path, std::string& build) {
+    std::ifstream file(path);
+    if (!file.is_open()) throw std::runtime_error("Cannot open file: " + path);
+    std::map<std::pair<std::string, size_t>, double> baseline;
+    std::string line, name, size, ns;
+    const std::string buildKey = "\"build\": ";
+    while (std::getline(file, line)) {
+        size_t buildPos = line.find(buildKey);
+        if (buildPos != std::string::npos) {
+            build = line.substr(buildPos + buildKey.size());
+            if (!build.empty() && build.back() == ',') build.pop_back();
+        } else if (extractField(line, "name", name) && extractField(line, "size", size) &&
+            extractField(line, "ns_per_op", ns)) {
+            baseline[{name, std::stoull(size)}] = std::stod(ns);
+        }
+    }
+    return baseline;
+}
+
+// Returns the number of regressions beyond the threshold
+int compareWithBaseline(const std::vector<BenchResult>& results, const BenchOptions& options) {
+    std::string baselineBuild = "(not recorded)";
+    auto baseline = readBaseline(options.baselinePath, baselineBuild);
+    int regressions = 0;
+    std::printf("\nComparison with %s (threshold %.1f%%)\n", options.baselinePath.c_str(), options.thresholdPct);
+    if (baselineBuild != buildDescription()) {
+        std::printf("  Warning: baseline build %s differs from this build %s\n", baselineBuild.c_str(),
+                    buildDescription().c_str());
+    }
+    for (const BenchResult& r : results) {
+        auto it = baseline.find({r.name, r.size});
+        if (it == baseline.end()) {
+            std::printf("  %-28s %10zu  (no baseline)\n", r.name.c_str(), r.size);
+            continue;
+        }
+        double change = (r.nsPerOp - it->second) / it->second * 100.0;
+        bool regressed = change > options.thresholdPct;
+        if (regressed) regressions++;
+        std::printf("  %-28s %10zu  %12.1f -> %12.1f ns/op  %+7.1f%%%s\n", r.name.c_str(), r.size,
+                    it->second, r.nsPerOp, change, regressed ? "  REGRESSION" : "");
+    }
+    return regressions;
+}
+
+}  // namespace
+
+int runBenchmarks(const std::string& suite, const std::vector<BenchCase>& cases, int argc, char* argv[]) {
+    try {
+        BenchOptions options = parseOptions(argc, argv);
+        std::vector<BenchResult> results;
+
+        std::printf("%-28s %10s %14s %14s %10s %12s %12s\n", suite.c_str(), "size", "ns/op",
+                    "items/s", "unit", "allocs/op", "bytes/op");
+        for (const BenchCase& c : cases) {
+            if (!options.filter.empty() && c.name.find(options.filter) == std::string::npos) continue;
+            for (size_t size : c.sizes) {
+                BenchResult r = measure(c, size, options);
+                std::printf("%-28s %10zu %14.1f %14.4g %10s %12.1f %12.1f\n", r.name.c_str(), r.size,
+                            r.nsPerOp, r.itemsPerSec, r.unit.c_str(), r.allocsPerOp, r.bytesPerOp);
+                std::fflush(stdout);
+                results.push_back(r);
+            }
+        }
+
+        if (!options.outPath.empty()) writeJson(options.outPath, suite, options, results);
+        if (!options.baselinePath.empty() && compareWithBaseline(results, options) > 0) return 1;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 2;
+    }
+}
+
+std::vector<WeightedEdge> randomGraph(size_t nodes, size_t edgesPerNode, int maxWeight, std::mt19937_64& rng) {
+    std::uniform_int_distribution<size_t> node(0, nodes - 1);
+    std::uniform_int_distribution<int> weight(1, maxWeight);
+    std::vector<WeightedEdge> edges;
+    edges.reserve(nodes * edgesPerNode);
+    for (size_t u = 0; u < nodes; u++) {
+        for (size_t e = 0; e < edgesPerNode; e++) {
+            edges.push_back({"N" + std::to_string(u), "N" + std::to_string(node(rng)), weight(rng)});
+        }
+    }
+    return edges;
+}
+
+std::vector<std::vector<int>> randomDenseMatrix(size_t rows, size_t cols, double density, std::mt19937_64& rng) {
+    std::bernoulli_distribution nonzero(density);
+    std::uniform_int_distribution<int> value(1, 9);
+    std::vector<std::vector<int>> mat(rows, std::vector<int>(cols, 0));
+    for (auto& row : mat) {
+        for (int& cell : row) {
+            if (nonzero(rng)) cell = value(rng);
+        }
+    }
+    return mat;
+}
+
+std::vector<std::vector<int>> randomSparseTriplets(size_t rows, size_t cols, size_t nnz, std::mt19937_64& rng) {
+    std::uniform_int_distribution<int> row(0, static_cast<int>(rows) - 1);
+    std::uniform_int_distribution<int> col(0, static_cast<int>(cols) - 1);
+    std::uniform_int_distribution<int> value(1, 9);
+    std::vector<std::vector<int>> sparse(3);
+    for (auto& v : sparse) v.reserve(nnz);
+    for (size_t k = 0; k < nnz; k++) {
+        sparse[0].push_back(row(rng));
+        sparse[1].push_back(col(rng));
+        sparse[2].push_back(value(rng));
+    }
+    return sparse;
+}
+
+std::vector<int> randomIntArray(size_t n, int lo, int hi, std::mt19937_64& rng) {
+    std::uniform_int_distribution<int> value(lo, hi);
+    std::vector<int> arr(n);
+    for (int& v : arr) v = value(rng);
+    return arr;
+}
+
+std::string randomString(size_t n, const std::string& alphabet, std::mt19937_64& rng) {
+    std::uniform_int_distribution<size_t> pick(0, alphabet.size() - 1);
+    std::string s(n, ' ');
+    for (char& ch : s) ch = alphabet[pick(rng)];
+    return s;
+}
+
+std::pair<std::string, std::vector<int>> randomFrequencyTable(size_t symbols, std::mt19937_64& rng) {
+    std::vector<int> codes(255);
+    std::iota(codes.begin(), codes.end(), 1);
+    std::shuffle(codes.begin(), codes.end(), rng);
+    symbols = std::min(symbols, codes.size());
+
+    std::uniform_int_distribution<int> frequency(1, 1000);
+    std::string chars;
+    std::vector<int> frequencies;
+    for (size_t i = 0; i < symbols; i++) {
+        chars.push_back(static_cast<char>(codes[i]));
+        frequencies.push_back(frequency(rng));
+    }
+    return {chars, frequencies};
+}
@@ -0,0 +1,71 @@
+#ifndef BENCH_HARNESS_H
+#define BENCH_HARNESS_H
+
+// Shared driver for the per-algorithm benchmark executables. Every case is
+// prepared from a seeded generator for each input size in its sweep, timed
+// until it has run for a minimum wall time, and reported as ns/op,
+// throughput and heap allocations per op. Results can be written as a JSON
+// baseline and compared against an earlier one:
+//
+//   bench_<suite> [--quick] [--min-time=MS] [--filter=TEXT] [--seed=N]
+//                 [--out=FILE.json] [--baseline=FILE.json] [--threshold=PCT]
+//
+// With --baseline the exit status is 1 when any case got slower than the
+// baseline by more than the threshold (10% by default). Results also record
+// the build settings (ALGO_NATIVE, instrumentation, build type), and a
+// baseline from a different build is reported before the comparison.
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// One prepared input: the operation to time and how many items one call processes
+struct BenchRun {
+    std::function<void()> op;
+    double itemsPerOp;
+};
+
+struct BenchCase {
+    std::string name;
+    std::string unit;                  // What an item is: "nnz", "edges", "bytes", ...
+    std::vector<size_t> sizes;         // Input sizes to sweep
+    std::function<BenchRun(size_t size, std::mt19937_64& rng)> prepare;
+};
+
+int runBenchmarks(const std::string& suite, const std::vector<BenchCase>& cases, int argc, char* argv[]);
+
+// Keeps the compiler from discarding a result that is otherwise unused
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+// Seeded synthetic inputs
+
+struct WeightedEdge {
+    std::string src;
+    std::string dest;
+    int weight;
+};
+
+// Nodes are named "N0".."N<nodes-1>"; every node gets edgesPerNode random out-edges
+std::vector<WeightedEdge> randomGraph(size_t nodes, size_t edgesPerNode, int maxWeight, std::mt19937_64& rng);
+
+// Dense rows x cols matrix where each cell is nonzero with the given probability
+std::vector<std::vector<int>> randomDenseMatrix(size_t rows, size_t cols, double density, std::mt19937_64& rng);
+
+// (row, column, value) triplets in the generateSparse layout, nonzero values, unsorted
+std::vector<std::vector<int>> randomSparseTriplets(size_t rows, size_t cols, size_t nnz, std::mt19937_64& rng);
+
+std::vector<int> randomIntArray(size_t n, int lo, int hi, std::mt19937_64& rng);
+
+std::string randomString(size_t n, const std::string& alphabet, std::mt19937_64& rng);
+
+// Distinct symbols (any byte except '\0') with frequencies in [1, 1000]
+std::pair<std::string, std::vector<int>> randomFrequencyTable(size_t symbols, std::mt19937_64& rng);
+
+#endif  // BENCH_HARNESS_H
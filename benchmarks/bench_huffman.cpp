@@ -0,0 +1,19 @@
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Huffman_Codes.h"
+#include "bench_harness.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+    vector<BenchCase> cases = {
+        {"buildHuffmanTree", "symbols", {8, 32, 128, 255}, [](size_t n, mt19937_64& rng) {
+            auto table = make_shared<pair<string, vector<int>>>(randomFrequencyTable(n, rng));
+            return BenchRun{[table]() { doNotOptimize(buildHuffmanTree(table->first, table->second)); },
+                            double(table->first.size())};
+        }},
+    };
+    return runBenchmarks("huffman", cases, argc, argv);
+}
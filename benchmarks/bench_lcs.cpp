@@ -0,0 +1,23 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "LCS.h"
+#include "bench_harness.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+    vector<BenchCase> cases = {
+        {"findLCS", "cells", {128, 256, 512, 1024, 2048}, [](size_t n, mt19937_64& rng) {
+            auto s1 = make_shared<string>(randomString(n, "ACGT", rng));
+            auto s2 = make_shared<string>(randomString(n, "ACGT", rng));
+            return BenchRun{[s1, s2]() {
+                int len;
+                doNotOptimize(findLCS(*s1, *s2, len, false));
+            }, double(n * n)};
+        }},
+    };
+    return runBenchmarks("lcs", cases, argc, argv);
+}
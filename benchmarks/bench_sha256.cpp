@@ -0,0 +1,20 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "SecureHash256.h"
+#include "bench_harness.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+    vector<BenchCase> cases = {
+        {"calculateHash", "bytes", {64, 1 << 10, 1 << 16, 1 << 20}, [](size_t n, mt19937_64& rng) {
+            auto message = make_shared<string>(randomString(n, "abcdefghijklmnopqrstuvwxyz0123456789", rng));
+            auto hasher = make_shared<SecureHash256>();
+            return BenchRun{[message, hasher]() { doNotOptimize(hasher->calculateHash(*message)); }, double(n)};
+        }},
+    };
+    return runBenchmarks("sha256", cases, argc, argv);
+}
@@ -0,0 +1,50 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Dijkstra_Graph.h"
+#include "bench_harness.h"
+
+using namespace std;
+
+namespace {
+
+shared_ptr<Graph> makeGraph(size_t nodes, size_t edgesPerNode, mt19937_64& rng) {
+    auto graph = make_shared<Graph>();
+    for (const auto& e : randomGraph(nodes, edgesPerNode, 100, rng)) graph->addEdge(e.src, e.dest, e.weight);
+    return graph;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t edgesPerNode = 4;
+    vector<BenchCase> cases = {
+        // The end node does not exist, so every query settles the whole reachable graph
+        {"dijkstra", "edges", {1 << 10, 1 << 12, 1 << 14}, [edgesPerNode](size_t n, mt19937_64& rng) {
+            auto graph = makeGraph(n, edgesPerNode, rng);
+            return BenchRun{[graph]() { doNotOptimize(graph->dijkstra("N0", "missing").first); },
+                            double(n * edgesPerNode)};
+        }},
+        {"trackSource", "edges", {1 << 10, 1 << 12, 1 << 14}, [edgesPerNode](size_t n, mt19937_64& rng) {
+            auto graph = makeGraph(n, edgesPerNode, rng);
+            return BenchRun{[graph]() { graph->trackSource("N0"); }, double(n * edgesPerNode)};
+        }},
+        {"repair_16_updates", "updates", {1 << 10, 1 << 12, 1 << 14}, [edgesPerNode](size_t n, mt19937_64& rng) {
+            const size_t batch = 16;
+            auto graph = makeGraph(n, edgesPerNode, rng);
+            graph->trackSource("N0");
+            auto edges = make_shared<vector<WeightedEdge>>(randomGraph(n, edgesPerNode, 100, rng));
+            auto next = make_shared<size_t>(0);
+            return BenchRun{[graph, edges, next, batch]() {
+                for (size_t k = 0; k < batch; k++) {
+                    const WeightedEdge& e = (*edges)[(*next)++ % edges->size()];
+                    graph->updateEdge(e.src, e.dest, e.weight);
+                }
+                graph->applyUpdates();
+            }, double(batch)};
+        }},
+    };
+    return runBenchmarks("shortest_path", cases, argc, argv);
+}
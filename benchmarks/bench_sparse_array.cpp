@@ -0,0 +1,46 @@
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Sparse_Array.h"
+#include "bench_harness.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+    vector<BenchCase> cases = {
+        {"generateSparse", "cells", {128, 256, 512, 1024}, [](size_t n, mt19937_64& rng) {
+            auto mat = make_shared<vector<vector<int>>>(randomDenseMatrix(n, n, 0.05, rng));
+            return BenchRun{[mat]() { doNotOptimize(generateSparse(*mat)); }, double(n * n)};
+        }},
+        {"csr_build", "nnz", {1 << 12, 1 << 14, 1 << 16, 1 << 18}, [](size_t n, mt19937_64& rng) {
+            auto sparse = make_shared<vector<vector<int>>>(randomSparseTriplets(n, n, n * 16, rng));
+            return BenchRun{[n, sparse]() { doNotOptimize(CSRMatrix(int(n), int(n), *sparse)); }, double(n * 16)};
+        }},
+        {"spmv", "nnz", {1 << 12, 1 << 14, 1 << 16, 1 << 18}, [](size_t n, mt19937_64& rng) {
+            auto a = make_shared<CSRMatrix>(int(n), int(n), randomSparseTriplets(n, n, n * 16, rng));
+            auto x = make_shared<vector<double>>(n, 1.0);
+            auto y = make_shared<vector<double>>();
+            return BenchRun{[a, x, y]() { a->multiply(*x, *y); doNotOptimize(*y); }, double(a->nonZeroCount())};
+        }},
+        {"spmv_transposed", "nnz", {1 << 12, 1 << 14, 1 << 16, 1 << 18}, [](size_t n, mt19937_64& rng) {
+            auto a = make_shared<CSRMatrix>(int(n), int(n), randomSparseTriplets(n, n, n * 16, rng));
+            auto x = make_shared<vector<double>>(n, 1.0);
+            auto y = make_shared<vector<double>>();
+            return BenchRun{[a, x, y]() { a->multiplyTransposed(*x, *y); doNotOptimize(*y); },
+                            double(a->nonZeroCount())};
+        }},
+        {"spgemm_AAt", "nnz", {1 << 10, 1 << 12, 1 << 14}, [](size_t n, mt19937_64& rng) {
+            auto a = make_shared<CSRMatrix>(int(n), int(n), randomSparseTriplets(n, n, n * 8, rng));
+            auto at = make_shared<CSRMatrix>(a->transposed());
+            return BenchRun{[a, at]() { doNotOptimize(multiplySparse(*a, *at)); }, double(a->nonZeroCount())};
+        }},
+        {"add", "nnz", {1 << 12, 1 << 14, 1 << 16}, [](size_t n, mt19937_64& rng) {
+            auto a = make_shared<CSRMatrix>(int(n), int(n), randomSparseTriplets(n, n, n * 16, rng));
+            auto b = make_shared<CSRMatrix>(int(n), int(n), randomSparseTriplets(n, n, n * 16, rng));
+            return BenchRun{[a, b]() { doNotOptimize(addSparse(*a, *b)); },
+                            double(a->nonZeroCount() + b->nonZeroCount())};
+        }},
+    };
+    return runBenchmarks("sparse_array", cases, argc, argv);
+}
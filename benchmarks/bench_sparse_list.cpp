@@ -0,0 +1,67 @@
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Sparse_Array.h"
+#include "Sparse_Linked_List.h"
+#include "bench_harness.h"
+
+using namespace std;
+
+namespace {
+
+// n x n list with about 8 entries per row, plus a batch of random positions inside it
+struct ListInput {
+    SparseMatrix matrix;
+    vector<pair<int, int>> positions;
+};
+
+shared_ptr<ListInput> makeListInput(size_t n, size_t batch, mt19937_64& rng) {
+    auto input = make_shared<ListInput>();
+    auto sparse = randomSparseTriplets(n, n, n * 8, rng);
+    for (size_t k = 0; k < sparse[0].size(); k++) {
+        input->matrix.setElement(sparse[0][k], sparse[1][k], sparse[2][k]);
+    }
+    uniform_int_distribution<int> index(0, int(n) - 1);
+    for (size_t k = 0; k < batch; k++) input->positions.emplace_back(index(rng), index(rng));
+    return input;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t batch = 1024;
+    vector<BenchCase> cases = {
+        {"convertToLinkedList", "nnz", {128, 256, 512, 1024}, [](size_t n, mt19937_64& rng) {
+            auto mat = make_shared<vector<vector<int>>>(randomDenseMatrix(n, n, 0.05, rng));
+            size_t nnz = generateSparse(*mat)[0].size();
+            return BenchRun{[mat]() {
+                SparseMatrix list;
+                convertToLinkedList(*mat, list);
+                doNotOptimize(list.nonZeroCount());
+            }, double(nnz)};
+        }},
+        {"getElement", "lookups", {1 << 10, 1 << 13, 1 << 16}, [batch](size_t n, mt19937_64& rng) {
+            auto input = makeListInput(n, batch, rng);
+            return BenchRun{[input]() {
+                long long sum = 0;
+                for (auto [r, c] : input->positions) sum += input->matrix.getElement(r, c);
+                doNotOptimize(sum);
+            }, double(batch)};
+        }},
+        {"setElement", "updates", {1 << 10, 1 << 13, 1 << 16}, [batch](size_t n, mt19937_64& rng) {
+            auto input = makeListInput(n, batch, rng);
+            return BenchRun{[input]() {
+                for (auto [r, c] : input->positions) input->matrix.setElement(r, c, 7);
+            }, double(batch)};
+        }},
+        {"remove_reinsert", "updates", {1 << 10, 1 << 13, 1 << 16}, [batch](size_t n, mt19937_64& rng) {
+            auto input = makeListInput(n, batch, rng);
+            return BenchRun{[input]() {
+                for (auto [r, c] : input->positions) input->matrix.removeElement(r, c);
+                for (auto [r, c] : input->positions) input->matrix.addElement(r, c, 3);
+            }, double(2 * batch)};
+        }},
+    };
+    return runBenchmarks("sparse_list", cases, argc, argv);
+}
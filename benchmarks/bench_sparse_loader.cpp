@@ -0,0 +1,54 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Sparse_Matrix_Loader.h"
+#include "bench_harness.h"
+
+using namespace std;
+
+namespace {
+
+// Temporary file removed when the last benchmark closure referencing it goes away
+struct TempFile {
+    string path;
+    explicit TempFile(const string& name) : path((filesystem::temp_directory_path() / name).string()) {}
+    ~TempFile() { remove(path.c_str()); }
+};
+
+shared_ptr<TempFile> writeMatrixMarket(size_t n, size_t nnz, mt19937_64& rng) {
+    auto file = make_shared<TempFile>("bench_sparse_loader_" + to_string(n) + ".mtx");
+    auto sparse = randomSparseTriplets(n, n, nnz, rng);
+    ofstream out(file->path);
+    out << "%%MatrixMarket matrix coordinate real general\n" << n << " " << n << " " << nnz << "\n";
+    for (size_t k = 0; k < nnz; k++) {
+        out << sparse[0][k] + 1 << " " << sparse[1][k] + 1 << " " << sparse[2][k] << ".5\n";
+    }
+    return file;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    vector<BenchCase> cases = {
+        {"loadMatrixMarket", "entries", {1 << 14, 1 << 17, 1 << 20}, [](size_t nnz, mt19937_64& rng) {
+            auto file = writeMatrixMarket(nnz / 4, nnz, rng);
+            return BenchRun{[file]() { doNotOptimize(loadMatrixMarket(file->path).nnz); }, double(nnz)};
+        }},
+        {"loadSparseCache", "entries", {1 << 14, 1 << 17, 1 << 20}, [](size_t nnz, mt19937_64& rng) {
+            auto file = writeMatrixMarket(nnz / 4, nnz, rng);
+            auto cache = make_shared<TempFile>("bench_sparse_loader_" + to_string(nnz) + ".cache");
+            saveSparseCache(loadMatrixMarket(file->path), cache->path);
+            return BenchRun{[cache]() {
+                SparseTriplets m = loadSparseCache(cache->path);
+                double sum = 0;
+                for (size_t k = 0; k < m.nnz; k++) sum += m.values[k];
+                doNotOptimize(sum);
+            }, double(nnz)};
+        }},
+    };
+    return runBenchmarks("sparse_loader", cases, argc, argv);
+}
@@ -0,0 +1,42 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Suffix_Automaton.h"
+#include "bench_harness.h"
+
+using namespace std;
+
+namespace {
+
+// Documents of 64 characters over a small alphabet, so substrings repeat across documents
+vector<string> randomDocuments(size_t count, mt19937_64& rng) {
+    vector<string> documents;
+    for (size_t i = 0; i < count; i++) documents.push_back(randomString(64, "abcdefgh", rng));
+    return documents;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    vector<BenchCase> cases = {
+        {"build", "chars", {1 << 8, 1 << 10, 1 << 12}, [](size_t n, mt19937_64& rng) {
+            auto documents = make_shared<vector<string>>(randomDocuments(n, rng));
+            return BenchRun{[documents]() {
+                GeneralizedSuffixAutomaton automaton(*documents);
+                doNotOptimize(automaton.stateCount());
+            }, double(n * 64)};
+        }},
+        {"longestShared_k2", "states", {1 << 8, 1 << 10, 1 << 12}, [](size_t n, mt19937_64& rng) {
+            auto automaton = make_shared<GeneralizedSuffixAutomaton>(randomDocuments(n, rng));
+            return BenchRun{[automaton]() { doNotOptimize(automaton->longestShared(2)); },
+                            double(automaton->stateCount())};
+        }},
+        {"topRepeated_10", "states", {1 << 8, 1 << 10, 1 << 12}, [](size_t n, mt19937_64& rng) {
+            auto automaton = make_shared<GeneralizedSuffixAutomaton>(randomDocuments(n, rng));
+            return BenchRun{[automaton]() { doNotOptimize(automaton->topRepeated(10, 4)); },
+                            double(automaton->stateCount())};
+        }},
+    };
+    return runBenchmarks("suffix_automaton", cases, argc, argv);
+}
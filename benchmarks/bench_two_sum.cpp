@@ -0,0 +1,25 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Two_Sum.h"
+#include "bench_harness.h"
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+    vector<BenchCase> cases = {
+        // Only non-negative values and a negative target: no pair exists, so the whole array is scanned
+        {"twoSum", "elements", {1 << 10, 1 << 13, 1 << 16, 1 << 19}, [](size_t n, mt19937_64& rng) {
+            auto arr = make_shared<vector<int>>(randomIntArray(n, 0, 1000000000, rng));
+            return BenchRun{[arr]() { doNotOptimize(twoSum(*arr, -1)); }, double(n)};
+        }},
+        {"parseInput", "elements", {1 << 10, 1 << 13, 1 << 16}, [](size_t n, mt19937_64& rng) {
+            auto input = make_shared<string>();
+            for (int v : randomIntArray(n, -1000000, 1000000, rng)) *input += to_string(v) + ", ";
+            return BenchRun{[input]() { doNotOptimize(parseInput(*input)); }, double(n)};
+        }},
+    };
+    return runBenchmarks("two_sum", cases, argc, argv);
+}
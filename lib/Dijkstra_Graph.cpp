@@ -0,0 +1,245 @@
+#include "Dijkstra_Graph.h"
+#include "Instrumentation.h"
+
+#include <vector>
+#include <queue>
+#include <unordered_map>
+#include <climits>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+int Graph::edgeWeight(const string& src, const string& dest) const {
+    int best = INT_MAX;
+    auto it = adjList.find(src);
+    if (it == adjList.end()) return best;
+    for (const auto& [neighbor, weight] : it->second) {
+        if (neighbor == dest) best = min(best, weight);
+    }
+    return best;
+}
+
+void Graph::recordChange(const string& src, const string& dest) {
+    if (!trees.empty()) pendingChanges.emplace_back(src, dest);
+}
+
+void Graph::eraseEdges(vector<pair<string, int>>& edges, const string& node) {
+    edges.erase(remove_if(edges.begin(), edges.end(),
+                          [&](const pair<string, int>& edge) { return edge.first == node; }),
+                edges.end());
+}
+
+void Graph::propagate(ShortestPathTree& tree, MinQueue& pq) {
+    while (!pq.empty()) {
+        auto [currentDist, currentNode] = pq.top();
+        pq.pop();
+        INSTRUMENT_COUNT(HeapPop, 1);
+        if (currentDist > distanceOf(tree, currentNode)) {
+            INSTRUMENT_COUNT(StaleHeapPop, 1);
+            continue;
+        }
+
+        auto it = adjList.find(currentNode);
+        if (it == adjList.end()) continue;
+        INSTRUMENT_COUNT(EdgeRelaxed, it->second.size());
+        for (const auto& [neighbor, weight] : it->second) {
+            int newDist = currentDist + weight;
+            if (newDist < distanceOf(tree, neighbor)) {
+                tree.dist[neighbor] = newDist;
+                tree.parent[neighbor] = currentNode;
+                pq.push({newDist, neighbor});
+                INSTRUMENT_COUNT(HeapPush, 1);
+            }
+        }
+    }
+}
+
+// Subtrees hanging from tree edges that got heavier or vanished are
+// invalidated and re-attached through their cheapest unaffected in-edge,
+// edges that got lighter seed their head, and a Dijkstra pass from those
+// seeds fixes exactly the nodes whose distance changes.
+void Graph::repairTree(ShortestPathTree& tree) {
+    INSTRUMENT_SCOPE("Graph::repairTree");
+    vector<string> stack;
+    for (const auto& [src, dest] : pendingChanges) {
+        auto it = tree.parent.find(dest);
+        if (it == tree.parent.end() || it->second != src) continue;
+        int weight = edgeWeight(src, dest);
+        if (weight == INT_MAX || distanceOf(tree, src) + weight > tree.dist[dest]) stack.push_back(dest);
+    }
+
+    vector<string> affected;
+    while (!stack.empty()) {
+        string node = stack.back();
+        stack.pop_back();
+        if (!tree.dist.erase(node)) continue;
+        tree.parent.erase(node);
+        affected.push_back(node);
+        auto it = adjList.find(node);
+        if (it == adjList.end()) continue;
+        for (const auto& [neighbor, weight] : it->second) {
+            auto parentIt = tree.parent.find(neighbor);
+            if (parentIt != tree.parent.end() && parentIt->second == node) stack.push_back(neighbor);
+        }
+    }
+
+    MinQueue pq;
+    for (const string& node : affected) {
+        int bestDist = INT_MAX;
+        string bestParent;
+        for (const auto& [from, weight] : revList[node]) {
+            int fromDist = distanceOf(tree, from);
+            if (fromDist != INT_MAX && fromDist + weight < bestDist) {
+                bestDist = fromDist + weight;
+                bestParent = from;
+            }
+        }
+        if (bestDist != INT_MAX) {
+            tree.dist[node] = bestDist;
+            tree.parent[node] = bestParent;
+            pq.push({bestDist, node});
+            INSTRUMENT_COUNT(HeapPush, 1);
+        }
+    }
+
+    for (const auto& [src, dest] : pendingChanges) {
+        int srcDist = distanceOf(tree, src);
+        int weight = edgeWeight(src, dest);
+        if (srcDist == INT_MAX || weight == INT_MAX) continue;
+        if (srcDist + weight < distanceOf(tree, dest)) {
+            tree.dist[dest] = srcDist + weight;
+            tree.parent[dest] = src;
+            pq.push({srcDist + weight, dest});
+            INSTRUMENT_COUNT(HeapPush, 1);
+        }
+    }
+
+    propagate(tree, pq);
+}
+
+void Graph::addEdge(const string& src, const string& dest, int weight) {
+    adjList[src].emplace_back(dest, weight);
+    if (!trees.empty()) revList[dest].emplace_back(src, weight);
+    recordChange(src, dest);
+}
+
+void Graph::updateEdge(const string& src, const string& dest, int weight) {
+    eraseEdges(adjList[src], dest);
+    if (!trees.empty()) eraseEdges(revList[dest], src);
+    addEdge(src, dest, weight);
+}
+
+bool Graph::removeEdge(const string& src, const string& dest) {
+    auto it = adjList.find(src);
+    if (it == adjList.end()) return false;
+    size_t before = it->second.size();
+    eraseEdges(it->second, dest);
+    if (it->second.size() == before) return false;
+    if (!trees.empty()) eraseEdges(revList[dest], src);
+    recordChange(src, dest);
+    return true;
+}
+
+void Graph::trackSource(const string& source) {
+    applyUpdates();
+    // Incoming edges are only needed for repairs, so build them on the first tracked source
+    if (trees.empty()) {
+        revList.clear();
+        for (const auto& [src, edges] : adjList) {
+            for (const auto& [dest, weight] : edges) revList[dest].emplace_back(src, weight);
+        }
+    }
+    ShortestPathTree& tree = trees[source];
+    tree.dist.clear();
+    tree.parent.clear();
+    tree.dist[source] = 0;
+    INSTRUMENT_SCOPE("Graph::trackSource");
+    MinQueue pq;
+    pq.push({0, source});
+    INSTRUMENT_COUNT(HeapPush, 1);
+    propagate(tree, pq);
+}
+
+void Graph::untrackSource(const string& source) {
+    trees.erase(source);
+    if (trees.empty()) {
+        pendingChanges.clear();
+        revList.clear();
+    }
+}
+
+void Graph::applyUpdates() {
+    if (pendingChanges.empty()) return;
+    for (auto& [source, tree] : trees) {
+        repairTree(tree);
+    }
+    pendingChanges.clear();
+}
+
+pair<int, vector<string>> Graph::trackedPath(const string& source, const string& end) {
+    auto treeIt = trees.find(source);
+    if (treeIt == trees.end()) {
+        throw invalid_argument("Source is not tracked: " + source);
+    }
+    applyUpdates();
+    const ShortestPathTree& tree = treeIt->second;
+    int cost = distanceOf(tree, end);
+    if (cost == INT_MAX) return {INT_MAX, {}};
+
+    vector<string> path;
+    for (string at = end; ; ) {
+        path.push_back(at);
+        auto it = tree.parent.find(at);
+        if (it == tree.parent.end()) break;
+        at = it->second;
+    }
+    reverse(path.begin(), path.end());
+    return {cost, path};
+}
+
+pair<int, vector<string>> Graph::dijkstra(const string& start, const string& end) {
+    INSTRUMENT_SCOPE("Graph::dijkstra");
+    unordered_map<string, int> dist;
+    unordered_map<string, string> prev;
+    auto cmp = [](pair<int, string>& a, pair<int, string>& b) { return a.first > b.first; };
+    priority_queue<pair<int, string>, vector<pair<int, string>>, decltype(cmp)> pq(cmp);
+
+    // Nodes missing from dist have not been reached; sinks never appear in adjList
+    dist[start] = 0;
+
+    pq.push({0, start});
+    INSTRUMENT_COUNT(HeapPush, 1);
+
+    while (!pq.empty()) {
+        auto [currentDist, currentNode] = pq.top();
+        pq.pop();
+        INSTRUMENT_COUNT(HeapPop, 1);
+        // Stale entries are still relaxed (harmlessly); only counted here
+        INSTRUMENT_COUNT(StaleHeapPop, currentDist > dist[currentNode] ? 1 : 0);
+
+        if (currentNode == end) {
+            vector<string> path;
+            for (string at = end; !at.empty(); at = prev[at]) {
+                path.insert(path.begin(), at);
+            }
+            return {currentDist, path};
+        }
+
+        auto it = adjList.find(currentNode);
+        if (it == adjList.end()) continue;
+        INSTRUMENT_COUNT(EdgeRelaxed, it->second.size());
+        for (const auto& [neighbor, weight] : it->second) {
+            int newDist = currentDist + weight;
+            auto known = dist.find(neighbor);
+            if (known == dist.end() || newDist < known->second) {
+                dist[neighbor] = newDist;
+                prev[neighbor] = currentNode;
+                pq.push({newDist, neighbor});
+                INSTRUMENT_COUNT(HeapPush, 1);
+            }
+        }
+    }
+
+    return {INT_MAX, {}};
+}
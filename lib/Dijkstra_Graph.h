@@ -0,0 +1,71 @@
+#ifndef DIJKSTRA_GRAPH_H
+#define DIJKSTRA_GRAPH_H
+
+// Weighted directed graph with string node names: one-off Dijkstra queries,
+// plus a dynamic mode that keeps shortest-path trees of tracked sources up to
+// date as edges are added, reweighted or removed.
+
+#include <climits>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class Graph {
+    std::unordered_map<std::string, std::vector<std::pair<std::string, int>>> adjList;
+    std::unordered_map<std::string, std::vector<std::pair<std::string, int>>> revList;  // Incoming edges, built on the first trackSource and kept only while sources are tracked
+
+    // Shortest-path tree of one registered source; nodes missing from dist are unreachable
+    struct ShortestPathTree {
+        std::unordered_map<std::string, int> dist;
+        std::unordered_map<std::string, std::string> parent;
+    };
+    std::unordered_map<std::string, ShortestPathTree> trees;
+    std::vector<std::pair<std::string, std::string>> pendingChanges;  // Edges changed since the trees were last repaired
+
+    using QueueEntry = std::pair<int, std::string>;
+    struct QueueOrder {
+        bool operator()(const QueueEntry& a, const QueueEntry& b) const { return a.first > b.first; }
+    };
+    using MinQueue = std::priority_queue<QueueEntry, std::vector<QueueEntry>, QueueOrder>;
+
+    static int distanceOf(const ShortestPathTree& tree, const std::string& node) {
+        auto it = tree.dist.find(node);
+        return it == tree.dist.end() ? INT_MAX : it->second;
+    }
+
+    // Lightest src -> dest edge, INT_MAX if there is none
+    int edgeWeight(const std::string& src, const std::string& dest) const;
+
+    void recordChange(const std::string& src, const std::string& dest);
+    static void eraseEdges(std::vector<std::pair<std::string, int>>& edges, const std::string& node);
+
+    // Dijkstra from the queued nodes, only touching nodes whose distance improves
+    void propagate(ShortestPathTree& tree, MinQueue& pq);
+
+    // Ramalingam-Reps style repair of one tree after a batch of edge changes
+    void repairTree(ShortestPathTree& tree);
+
+public:
+    void addEdge(const std::string& src, const std::string& dest, int weight);
+
+    // Sets the weight of src -> dest, replacing any parallel edges, or adds the edge
+    void updateEdge(const std::string& src, const std::string& dest, int weight);
+
+    bool removeEdge(const std::string& src, const std::string& dest);
+
+    // Dynamic mode: keep a shortest-path tree from source up to date across edge changes
+    void trackSource(const std::string& source);
+    void untrackSource(const std::string& source);
+
+    // Repair every tracked tree for the edge changes made since the last call
+    void applyUpdates();
+
+    // Distance and path from a tracked source, INT_MAX / empty when unreachable
+    std::pair<int, std::vector<std::string>> trackedPath(const std::string& source, const std::string& end);
+
+    std::pair<int, std::vector<std::string>> dijkstra(const std::string& start, const std::string& end);
+};
+
+#endif  // DIJKSTRA_GRAPH_H
@@ -0,0 +1,62 @@
+#include "Huffman_Codes.h"
+#include "Instrumentation.h"
+
+#include <queue>
+#include <unordered_map>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+#include <cctype>
+using namespace std;
+
+void generateHuffmanCodes(HuffmanTreeNode* root, string code, unordered_map<char, string>& huffmanMap) {
+    if (!root) return;
+    if (!root->left && !root->right) {
+        huffmanMap[root->character] = code;
+    }
+    generateHuffmanCodes(root->left, code + "0", huffmanMap);
+    generateHuffmanCodes(root->right, code + "1", huffmanMap);
+}
+
+void freeHuffmanTree(HuffmanTreeNode* root) {
+    if (!root) return;
+    freeHuffmanTree(root->left);
+    freeHuffmanTree(root->right);
+    delete root;
+}
+
+unordered_map<char, string> buildHuffmanTree(const string& symbols, const vector<int>& frequencies) {
+    INSTRUMENT_SCOPE("buildHuffmanTree");
+    priority_queue<HuffmanTreeNode*, vector<HuffmanTreeNode*>, CompareNodes> minHeap;
+    for (size_t i = 0; i < symbols.size(); ++i) {
+        minHeap.push(new HuffmanTreeNode(symbols[i], frequencies[i]));
+    }
+    INSTRUMENT_COUNT(HuffmanNodeAllocated, symbols.size());
+    while (minHeap.size() > 1) {
+        HuffmanTreeNode *left = minHeap.top(); minHeap.pop();
+        HuffmanTreeNode *right = minHeap.top(); minHeap.pop();
+        HuffmanTreeNode *parent = new HuffmanTreeNode('#', left->frequency + right->frequency);
+        INSTRUMENT_COUNT(HuffmanNodeAllocated, 1);
+        parent->left = left;
+        parent->right = right;
+        minHeap.push(parent);
+    }
+    unordered_map<char, string> huffmanMap;
+    generateHuffmanCodes(minHeap.top(), "", huffmanMap);
+    freeHuffmanTree(minHeap.top());
+    return huffmanMap;
+}
+
+bool isValidCharacterSet(const string& input) {
+    return all_of(input.begin(), input.end(), [](char ch) { return isalpha(ch); });
+}
+
+bool isValidFrequencyInput(const string& input, vector<int>& frequencyList, size_t expectedSize) {
+    frequencyList.clear();
+    stringstream freqStream(input);
+    int freq;
+    while (freqStream >> freq) {
+        frequencyList.push_back(freq);
+    }
+    return frequencyList.size() == expectedSize;
+}
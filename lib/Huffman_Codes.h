@@ -0,0 +1,29 @@
+#ifndef HUFFMAN_CODES_H
+#define HUFFMAN_CODES_H
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct HuffmanTreeNode {
+    char character;
+    int frequency;
+    HuffmanTreeNode *left, *right;
+    
+    HuffmanTreeNode(char c, int f) : character(c), frequency(f), left(nullptr), right(nullptr) {}
+};
+
+struct CompareNodes {
+    bool operator()(HuffmanTreeNode* a, HuffmanTreeNode* b) {
+        return a->frequency > b->frequency;
+    }
+};
+
+void generateHuffmanCodes(HuffmanTreeNode* root, std::string code, std::unordered_map<char, std::string>& huffmanMap);
+void freeHuffmanTree(HuffmanTreeNode* root);
+std::unordered_map<char, std::string> buildHuffmanTree(const std::string& symbols, const std::vector<int>& frequencies);
+bool isValidCharacterSet(const std::string& input);
+bool isValidFrequencyInput(const std::string& input, std::vector<int>& frequencyList, size_t expectedSize);
+
+#endif  // HUFFMAN_CODES_H
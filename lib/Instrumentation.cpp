@@ -0,0 +1,253 @@
+#include "Instrumentation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+namespace instrument {
+
+namespace {
+
+const char* const counterNames[] = {
+    "heap_push",
+    "heap_pop",
+    "stale_heap_pop",
+    "edge_relaxed",
+    "huffman_node_allocated",
+    "lcs_cell_computed",
+    "hash_probe",
+    "list_traversal_step",
+    "sha256_block_compressed",
+};
+static_assert(sizeof(counterNames) / sizeof(counterNames[0]) == static_cast<size_t>(Counter::Count),
+              "every counter needs a name");
+
+// Escapes a scope name for a JSON string literal
+string jsonString(const string& text) {
+    string out = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out + "\"";
+}
+
+}  // namespace
+
+const char* counterName(Counter counter) {
+    return counterNames[static_cast<int>(counter)];
+}
+
+#if ALGO_INSTRUMENTATION
+
+namespace {
+
+// Events beyond this many per thread still count towards the scope totals
+// but are left out of the Chrome trace
+const size_t maxEventsPerThread = 1 << 20;
+
+struct ScopeEvent {
+    const char* name;
+    int64_t startNs;
+    int64_t durationNs;
+    int thread;
+};
+
+struct ScopeTotal {
+    uint64_t calls = 0;
+    int64_t totalNs = 0;
+};
+
+// Process-wide totals that each thread merges into when it exits
+struct Registry {
+    mutex lock;
+    uint64_t counters[static_cast<int>(Counter::Count)] = {};
+    map<string, ScopeTotal> scopes;
+    vector<ScopeEvent> events;
+    int nextThread = 0;
+    int64_t originNs = nowNs();
+
+    ~Registry();
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+struct ThreadState;
+
+// Null before the thread registers and again once its state is destroyed
+thread_local ThreadState* currentState = nullptr;
+
+// Per-thread buffer; its destructor runs when the thread exits
+struct ThreadState {
+    int thread;
+    vector<ScopeEvent> events;
+    map<const char*, ScopeTotal> scopes;
+
+    ThreadState() {
+        Registry& shared = registry();
+        lock_guard<mutex> guard(shared.lock);
+        thread = shared.nextThread++;
+    }
+
+    ~ThreadState() {
+        flush();
+        currentState = nullptr;
+    }
+
+    void flush();
+};
+
+void ThreadState::flush() {
+    Registry& shared = registry();
+    lock_guard<mutex> guard(shared.lock);
+    for (int i = 0; i < static_cast<int>(Counter::Count); i++) {
+        shared.counters[i] += threadCounters[i];
+        threadCounters[i] = 0;
+    }
+    for (const auto& [name, scope] : scopes) {
+        ScopeTotal& merged = shared.scopes[name];
+        merged.calls += scope.calls;
+        merged.totalNs += scope.totalNs;
+    }
+    scopes.clear();
+    shared.events.insert(shared.events.end(), events.begin(), events.end());
+    events.clear();
+}
+
+Registry::~Registry() {
+    const char* path = getenv("ALGO_INSTRUMENT_OUT");
+    if (!path || !*path) return;
+    const char* format = getenv("ALGO_INSTRUMENT_FORMAT");
+    if (!exportTo(path, format && *format ? format : "json")) {
+        cerr << "Error: Could not write instrumentation to " << path << endl;
+    }
+}
+
+// Constructed up front so the exit-time export happens even if nothing was counted
+const bool registryReady = (registry(), true);
+
+// Merges the calling thread so exports include its work so far
+void flushCurrentThread() {
+    if (currentState) currentState->flush();
+}
+
+}  // namespace
+
+thread_local uint64_t threadCounters[static_cast<int>(Counter::Count)] = {};
+thread_local bool threadRegistered = false;
+
+void registerThread() {
+    thread_local ThreadState state;
+    currentState = &state;
+    threadRegistered = true;
+}
+
+int64_t nowNs() {
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void recordScope(const char* name, int64_t startNs, int64_t endNs) {
+    if (!threadRegistered) registerThread();
+    if (!currentState) return;
+    ThreadState& state = *currentState;
+    ScopeTotal& scope = state.scopes[name];
+    scope.calls++;
+    scope.totalNs += endNs - startNs;
+    if (state.events.size() < maxEventsPerThread) {
+        state.events.push_back({name, startNs, endNs - startNs, state.thread});
+    }
+}
+
+uint64_t total(Counter counter) {
+    flushCurrentThread();
+    Registry& shared = registry();
+    lock_guard<mutex> guard(shared.lock);
+    return shared.counters[static_cast<int>(counter)];
+}
+
+void writeJson(ostream& out) {
+    flushCurrentThread();
+    Registry& shared = registry();
+    lock_guard<mutex> guard(shared.lock);
+    out << "{\n  \"counters\": {";
+    for (int i = 0; i < static_cast<int>(Counter::Count); i++) {
+        out << (i ? ",\n" : "\n") << "    " << jsonString(counterNames[i]) << ": " << shared.counters[i];
+    }
+    out << "\n  },\n  \"scopes\": {";
+    bool first = true;
+    for (const auto& [name, scope] : shared.scopes) {
+        out << (first ? "\n" : ",\n") << "    " << jsonString(name)
+            << ": {\"calls\": " << scope.calls << ", \"total_ns\": " << scope.totalNs << "}";
+        first = false;
+    }
+    out << "\n  }\n}\n";
+}
+
+// Scopes become complete ("X") events and the counter totals one counter ("C")
+// event at the end of the trace; timestamps are microseconds since start-up.
+void writeChromeTrace(ostream& out) {
+    flushCurrentThread();
+    Registry& shared = registry();
+    lock_guard<mutex> guard(shared.lock);
+    vector<ScopeEvent> events = shared.events;
+    sort(events.begin(), events.end(),
+         [](const ScopeEvent& a, const ScopeEvent& b) { return a.startNs < b.startNs; });
+
+    int64_t endNs = shared.originNs;
+    out << "{\"traceEvents\": [\n";
+    for (const ScopeEvent& event : events) {
+        out << "  {\"name\": " << jsonString(event.name) << ", \"ph\": \"X\", \"pid\": 1, \"tid\": " << event.thread
+            << ", \"ts\": " << (event.startNs - shared.originNs) / 1000.0
+            << ", \"dur\": " << event.durationNs / 1000.0 << "},\n";
+        endNs = max(endNs, event.startNs + event.durationNs);
+    }
+    out << "  {\"name\": \"counters\", \"ph\": \"C\", \"pid\": 1, \"tid\": 0, \"ts\": "
+        << (endNs - shared.originNs) / 1000.0 << ", \"args\": {";
+    for (int i = 0; i < static_cast<int>(Counter::Count); i++) {
+        out << (i ? ", " : "") << jsonString(counterNames[i]) << ": " << shared.counters[i];
+    }
+    out << "}}\n], \"displayTimeUnit\": \"ns\"}\n";
+}
+
+#else
+
+uint64_t total(Counter) {
+    return 0;
+}
+
+void writeJson(ostream& out) {
+    out << "{\n  \"counters\": {";
+    for (int i = 0; i < static_cast<int>(Counter::Count); i++) {
+        out << (i ? ",\n" : "\n") << "    " << jsonString(counterNames[i]) << ": 0";
+    }
+    out << "\n  },\n  \"scopes\": {}\n}\n";
+}
+
+void writeChromeTrace(ostream& out) {
+    out << "{\"traceEvents\": [], \"displayTimeUnit\": \"ns\"}\n";
+}
+
+#endif
+
+bool exportTo(const string& path, const string& format) {
+    ofstream out(path);
+    if (!out) return false;
+    if (format == "chrome") {
+        writeChromeTrace(out);
+    } else {
+        writeJson(out);
+    }
+    return static_cast<bool>(out);
+}
+
+}  // namespace instrument
@@ -0,0 +1,90 @@
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+// Hot-path counters and scoped timers, compiled in only when
+// ALGO_INSTRUMENTATION is defined to 1 (CMake option ALGO_INSTRUMENTATION).
+// Without it INSTRUMENT_COUNT and INSTRUMENT_SCOPE expand to nothing and their
+// arguments are never evaluated.
+//
+// Counters are kept per thread and merged into the process totals when the
+// thread exits. At process exit the totals are written to the file named by
+// ALGO_INSTRUMENT_OUT, as a JSON summary or, with ALGO_INSTRUMENT_FORMAT=chrome,
+// in Chrome trace-event format (chrome://tracing, Perfetto).
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace instrument {
+
+enum class Counter : int {
+    HeapPush,               // Graph: priority-queue pushes
+    HeapPop,                // Graph: priority-queue pops
+    StaleHeapPop,           // Graph: pops of entries already superseded by a shorter distance
+    EdgeRelaxed,            // Graph: edges examined from a settled node
+    HuffmanNodeAllocated,   // buildHuffmanTree: tree nodes allocated
+    LcsCellComputed,        // findLCS: DP cells filled
+    HashProbe,              // twoSum: hash-table lookups and inserts
+    ListTraversalStep,      // SparseMatrix: nodes walked to find an insert/lookup position
+    Sha256BlockCompressed,  // SecureHash256::processBlocks: 512-bit blocks compressed
+    Count
+};
+
+const char* counterName(Counter counter);
+
+#if ALGO_INSTRUMENTATION
+
+extern thread_local uint64_t threadCounters[static_cast<int>(Counter::Count)];
+extern thread_local bool threadRegistered;
+
+// Arranges for this thread's counters to be merged when it exits
+void registerThread();
+
+inline void add(Counter counter, uint64_t n) {
+    if (!threadRegistered) registerThread();
+    threadCounters[static_cast<int>(counter)] += n;
+}
+
+// Records one complete event for the calling thread; name must be a string literal
+void recordScope(const char* name, int64_t startNs, int64_t endNs);
+
+int64_t nowNs();
+
+class ScopedTimer {
+private:
+    const char* name;
+    int64_t start;
+
+public:
+    explicit ScopedTimer(const char* scopeName) : name(scopeName), start(nowNs()) {}
+    ~ScopedTimer() { recordScope(name, start, nowNs()); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+};
+
+#define INSTRUMENT_CONCAT_INNER(a, b) a##b
+#define INSTRUMENT_CONCAT(a, b) INSTRUMENT_CONCAT_INNER(a, b)
+#define INSTRUMENT_COUNT(counter, n) ::instrument::add(::instrument::Counter::counter, (n))
+#define INSTRUMENT_SCOPE(name) ::instrument::ScopedTimer INSTRUMENT_CONCAT(instrumentScope, __LINE__)(name)
+
+#else
+
+#define INSTRUMENT_COUNT(counter, n) ((void)0)
+#define INSTRUMENT_SCOPE(name) ((void)0)
+
+#endif
+
+// Current process totals (merging the calling thread first); zero when compiled out
+uint64_t total(Counter counter);
+
+// Export the merged data. Threads still running contribute once they exit.
+void writeJson(std::ostream& out);
+void writeChromeTrace(std::ostream& out);
+
+// Write to path in "json" or "chrome" format; returns false if the file cannot be written
+bool exportTo(const std::string& path, const std::string& format = "json");
+
+}  // namespace instrument
+
+#endif  // INSTRUMENTATION_H
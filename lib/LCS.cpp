@@ -0,0 +1,46 @@
+#include "LCS.h"
+#include "Instrumentation.h"
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cctype>
+
+void toUpper(std::string& s) {
+    for (char& c : s) c = toupper(c);
+}
+
+bool isAlpha(const std::string& s) {
+    return std::all_of(s.begin(), s.end(), ::isalpha);
+}
+
+std::string findLCS(const std::string& s1, const std::string& s2, int& len, bool printTable) {
+    INSTRUMENT_SCOPE("findLCS");
+    int n = s1.size();
+    std::vector<std::vector<int>> dp(n + 1, std::vector<int>(n + 1, 0));
+    len = 0;
+    int endIdx = 0;
+
+    for (int i = 1; i <= n; ++i) {
+        INSTRUMENT_COUNT(LcsCellComputed, n);
+        for (int j = 1; j <= n; ++j) {
+            if (s1[i - 1] == s2[j - 1]) {
+                dp[i][j] = dp[i - 1][j - 1] + 1;
+                if (dp[i][j] > len) {
+                    len = dp[i][j];
+                    endIdx = i;
+                }
+            }
+        }
+    }
+    
+    if (printTable) {
+        std::cout << "LCS Table:\n";
+        for (const auto& row : dp) {
+            for (int cell : row) std::cout << cell << " ";
+            std::cout << "\n";
+        }
+    }
+
+    return s1.substr(endIdx - len, len);
+}
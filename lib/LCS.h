@@ -0,0 +1,13 @@
+#ifndef LCS_H
+#define LCS_H
+
+#include <string>
+
+void toUpper(std::string& s);
+bool isAlpha(const std::string& s);
+
+// Longest common substring of s1 and s2 by dynamic programming; len receives its
+// length. printTable writes the DP table to std::cout.
+std::string findLCS(const std::string& s1, const std::string& s2, int& len, bool printTable = true);
+
+#endif  // LCS_H
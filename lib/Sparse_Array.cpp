@@ -0,0 +1,439 @@
+#include "Sparse_Array.h"
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+using namespace std;
+
+// Function to read a matrix from user input
+void readMatrix(int r, int c, vector<vector<int>> &mat) {
+    cout << "Enter the elements of the matrix:" << endl;
+    for (int i = 0; i < r; i++) {
+        vector<int> row(c);
+        for (int j = 0; j < c; j++) {
+            cin >> row[j];
+        }
+        mat.push_back(row);
+    }
+}
+
+// Function to display a matrix
+void printMatrix(const vector<vector<int>> &mat) {
+    cout << "Here is the matrix you entered:" << endl;
+    for (const auto &row : mat) {
+        for (int val : row) {
+            cout << val << " ";
+        }
+        cout << endl;
+    }
+}
+
+// Function to generate sparse matrix representation
+vector<vector<int>> generateSparse(const vector<vector<int>> &mat) {
+    vector<vector<int>> sparse(3);
+    for (int i = 0; i < mat.size(); i++) {
+        for (int j = 0; j < mat[i].size(); j++) {
+            if (mat[i][j] != 0) {
+                sparse[0].push_back(i);  // Row index
+                sparse[1].push_back(j);  // Column index
+                sparse[2].push_back(mat[i][j]);  // Non-zero value
+            }
+        }
+    }
+    return sparse;
+}
+
+// Function to display sparse matrix representation
+void printSparse(const vector<vector<int>> &sparse) {
+    cout << "Sparse Matrix Representation:" << endl;
+    cout << "Row ->    ";
+    for (int val : sparse[0]) cout << val << " ";
+    cout << endl;
+    cout << "Column -> ";
+    for (int val : sparse[1]) cout << val << " ";
+    cout << endl;
+    cout << "Value ->  ";
+    for (int val : sparse[2]) cout << val << " ";
+    cout << endl;
+}
+
+// Function to split [0, n) into contiguous blocks of roughly equal work, one per
+// thread, where prefix[i] is the total work of items before i (prefix has n + 1 entries)
+static vector<size_t> splitBlocks(const vector<size_t> &prefix, size_t minWorkPerBlock = 1 << 16) {
+    size_t n = prefix.size() - 1;
+    size_t total = prefix[n];
+    size_t blockCount = max<size_t>(1, thread::hardware_concurrency());
+    blockCount = min(blockCount, max<size_t>(1, total / minWorkPerBlock));
+
+    vector<size_t> bounds(1, 0);
+    for (size_t b = 1; b < blockCount; b++) {
+        size_t target = total * b / blockCount;
+        bounds.push_back(upper_bound(prefix.begin() + bounds.back(), prefix.end() - 1, target) - prefix.begin());
+    }
+    bounds.push_back(n);
+    return bounds;
+}
+
+// Function to run fn(first, last, block) for every block, one thread per block
+template <typename Fn>
+static void runBlocks(const vector<size_t> &bounds, Fn fn) {
+    size_t blockCount = bounds.size() - 1;
+    if (blockCount == 1) {
+        fn(bounds[0], bounds[1], size_t(0));
+        return;
+    }
+    vector<thread> workers;
+    for (size_t b = 0; b < blockCount; b++) {
+        workers.emplace_back([&fn, &bounds, b]() { fn(bounds[b], bounds[b + 1], b); });
+    }
+    for (auto &worker : workers) worker.join();
+}
+
+// Every block counts its minor indices, the per-block counts are turned into
+// write offsets, then every block scatters its entries. Each block needs
+// minorDim counters, so a block gets at least minorDim entries and the
+// counters stay within O(nnz + minorDim) for wide matrices.
+CompressedMatrix transposeCompressed(const CompressedMatrix &m, int minorDim) {
+    CompressedMatrix t;
+    size_t nnz = m.idx.size();
+    t.ptr.assign(minorDim + 1, 0);
+    t.idx.resize(nnz);
+    t.values.resize(nnz);
+
+    vector<size_t> bounds = splitBlocks(m.ptr, max<size_t>(1 << 16, minorDim));
+    size_t blockCount = bounds.size() - 1;
+    vector<vector<size_t>> offsets(blockCount, vector<size_t>(minorDim, 0));
+
+    runBlocks(bounds, [&](size_t first, size_t last, size_t b) {
+        vector<size_t> &count = offsets[b];
+        for (size_t k = m.ptr[first]; k < m.ptr[last]; k++) count[m.idx[k]]++;
+    });
+
+    size_t running = 0;
+    for (int j = 0; j < minorDim; j++) {
+        t.ptr[j] = running;
+        for (size_t b = 0; b < blockCount; b++) {
+            size_t count = offsets[b][j];
+            offsets[b][j] = running;
+            running += count;
+        }
+    }
+    t.ptr[minorDim] = running;
+
+    runBlocks(bounds, [&](size_t first, size_t last, size_t b) {
+        vector<size_t> &next = offsets[b];
+        for (size_t i = first; i < last; i++) {
+            for (size_t k = m.ptr[i]; k < m.ptr[i + 1]; k++) {
+                size_t dest = next[m.idx[k]]++;
+                t.idx[dest] = static_cast<int>(i);
+                t.values[dest] = m.values[k];
+            }
+        }
+    });
+    return t;
+}
+
+// Function to build compressed storage row by row in parallel. Rows are split
+// by work[] (prefix sums of per-row cost); produceRow(i, block, idx, values)
+// appends the sorted entries of row i to its block's buffers, which are then
+// copied into place.
+template <typename ProduceRow>
+static CompressedMatrix buildRowwise(const vector<size_t> &work, const vector<size_t> &bounds, ProduceRow produceRow) {
+    size_t majorDim = work.size() - 1;
+    size_t blockCount = bounds.size() - 1;
+    CompressedMatrix result;
+    result.ptr.assign(majorDim + 1, 0);
+    vector<CompressedMatrix> parts(blockCount);
+
+    runBlocks(bounds, [&](size_t first, size_t last, size_t b) {
+        CompressedMatrix &part = parts[b];
+        for (size_t i = first; i < last; i++) {
+            size_t before = part.idx.size();
+            produceRow(i, b, part.idx, part.values);
+            result.ptr[i + 1] = part.idx.size() - before;
+        }
+    });
+
+    for (size_t i = 0; i < majorDim; i++) result.ptr[i + 1] += result.ptr[i];
+    result.idx.resize(result.ptr[majorDim]);
+    result.values.resize(result.ptr[majorDim]);
+
+    runBlocks(bounds, [&](size_t first, size_t, size_t b) {
+        copy(parts[b].idx.begin(), parts[b].idx.end(), result.idx.begin() + result.ptr[first]);
+        copy(parts[b].values.begin(), parts[b].values.end(), result.values.begin() + result.ptr[first]);
+        CompressedMatrix().ptr.swap(parts[b].ptr);
+        vector<int>().swap(parts[b].idx);
+        vector<double>().swap(parts[b].values);
+    });
+    return result;
+}
+
+double CSRMatrix::rowDot(const CompressedMatrix &m, size_t begin, size_t end, const double *x) {
+    double sum = 0.0;
+    size_t k = begin;
+#if defined(__AVX2__) && defined(__FMA__)
+    const __m256d allLanes = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+    __m256d acc = _mm256_setzero_pd();
+    for (; k + 4 <= end; k += 4) {
+        __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&m.idx[k]));
+        __m256d gathered = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, index, allLanes, 8);
+        acc = _mm256_fmadd_pd(_mm256_loadu_pd(&m.values[k]), gathered, acc);
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, acc);
+    sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#endif
+    for (; k < end; k++) {
+        sum += m.values[k] * x[m.idx[k]];
+    }
+    return sum;
+}
+
+// Rows are split into blocks of roughly equal nonzero count
+void CSRMatrix::multiply(const CompressedMatrix &m, const vector<double> &x, vector<double> &y) {
+    y.assign(m.ptr.size() - 1, 0.0);
+    runBlocks(splitBlocks(m.ptr), [&](size_t first, size_t last, size_t) {
+        for (size_t i = first; i < last; i++) {
+            y[i] = rowDot(m, m.ptr[i], m.ptr[i + 1], x.data());
+        }
+    });
+}
+
+CSRMatrix::CSRMatrix(int r, int c, CompressedMatrix rowMajor, CompressedMatrix colMajor)
+    : rows(r), cols(c), csr(std::move(rowMajor)), csc(std::move(colMajor)) {}
+
+CSRMatrix::CSRMatrix(int r, int c, const vector<vector<int>> &sparse) : rows(r), cols(c) {
+    size_t nnz = sparse[0].size();
+    CompressedMatrix unsorted;
+    unsorted.ptr.assign(rows + 1, 0);
+    unsorted.idx.resize(nnz);
+    unsorted.values.resize(nnz);
+
+    for (int i : sparse[0]) unsorted.ptr[i + 1]++;
+    for (int i = 0; i < rows; i++) unsorted.ptr[i + 1] += unsorted.ptr[i];
+    vector<size_t> next(unsorted.ptr.begin(), unsorted.ptr.end() - 1);
+    for (size_t k = 0; k < nnz; k++) {
+        size_t dest = next[sparse[0][k]]++;
+        unsorted.idx[dest] = sparse[1][k];
+        unsorted.values[dest] = sparse[2][k];
+    }
+
+    // Two transposes leave both forms with sorted minor indices
+    csc = transposeCompressed(unsorted, cols);
+    csr = transposeCompressed(csc, rows);
+}
+
+CSRMatrix::CSRMatrix(const SparseTriplets &m) : rows(m.rows), cols(m.cols) {
+    csr.ptr.assign(rows + 1, 0);
+    for (size_t k = 0; k < m.nnz; k++) csr.ptr[m.rowIdx[k] + 1]++;
+    for (int i = 0; i < rows; i++) csr.ptr[i + 1] += csr.ptr[i];
+    csr.idx.assign(m.colIdx, m.colIdx + m.nnz);
+    csr.values.assign(m.values, m.values + m.nnz);
+    csc = transposeCompressed(csr, cols);
+}
+
+CSRMatrix::CSRMatrix(int r, int c, CompressedMatrix rowMajor) : rows(r), cols(c), csr(std::move(rowMajor)) {
+    csc = transposeCompressed(csr, cols);
+}
+
+CSRMatrix CSRMatrix::transposed() const {
+    return CSRMatrix(cols, rows, csc, csr);
+}
+
+void CSRMatrix::multiply(const vector<double> &x, vector<double> &y) const {
+    if (x.size() != static_cast<size_t>(cols)) {
+        throw invalid_argument("Cannot multiply: vector length differs from the column count");
+    }
+    multiply(csr, x, y);
+}
+
+void CSRMatrix::multiplyTransposed(const vector<double> &x, vector<double> &y) const {
+    if (x.size() != static_cast<size_t>(rows)) {
+        throw invalid_argument("Cannot multiply: vector length differs from the row count");
+    }
+    multiply(csc, x, y);
+}
+
+// Per-thread scratch for Gustavson's algorithm. Rows whose flop count is a
+// sizeable fraction of the output width use a dense accumulator, the rest an
+// open-addressing hash table sized to the row's flop count.
+struct RowAccumulator {
+    vector<double> dense;
+    vector<int> denseOwner;      // Row that last wrote each dense slot
+    vector<int> hashKeys;        // -1 marks an empty slot
+    vector<double> hashValues;
+    vector<int> touched;         // Columns (dense) or slots (hash) used by the current row
+    vector<pair<int, double>> entries;
+};
+
+// Function to multiply two sparse matrices (C = A * B) with Gustavson's row-wise
+// algorithm. Rows are split across threads by their flop count, not row count.
+CSRMatrix multiplySparse(const CSRMatrix &a, const CSRMatrix &b) {
+    if (a.colCount() != b.rowCount()) {
+        throw invalid_argument("Cannot multiply: inner dimensions differ");
+    }
+    const CompressedMatrix &am = a.rowMajor();
+    const CompressedMatrix &bm = b.rowMajor();
+    int rows = a.rowCount(), cols = b.colCount();
+
+    // work[i + 1] - work[i] = multiply-adds needed for row i
+    vector<size_t> work(rows + 1, 0);
+    runBlocks(splitBlocks(am.ptr), [&](size_t first, size_t last, size_t) {
+        for (size_t i = first; i < last; i++) {
+            size_t flops = 0;
+            for (size_t k = am.ptr[i]; k < am.ptr[i + 1]; k++) {
+                flops += bm.ptr[am.idx[k] + 1] - bm.ptr[am.idx[k]];
+            }
+            work[i + 1] = flops;
+        }
+    });
+    for (int i = 0; i < rows; i++) work[i + 1] += work[i];
+
+    vector<size_t> bounds = splitBlocks(work);
+    vector<RowAccumulator> scratch(bounds.size() - 1);
+
+    auto produceRow = [&](size_t i, size_t block, vector<int> &idx, vector<double> &values) {
+        size_t flops = work[i + 1] - work[i];
+        if (flops == 0) return;
+        RowAccumulator &acc = scratch[block];
+        int row = static_cast<int>(i);
+
+        if (flops * 8 >= static_cast<size_t>(cols)) {
+            if (acc.dense.empty()) {
+                acc.dense.assign(cols, 0.0);
+                acc.denseOwner.assign(cols, -1);
+            }
+            for (size_t k = am.ptr[i]; k < am.ptr[i + 1]; k++) {
+                int mid = am.idx[k];
+                double av = am.values[k];
+                for (size_t l = bm.ptr[mid]; l < bm.ptr[mid + 1]; l++) {
+                    int j = bm.idx[l];
+                    if (acc.denseOwner[j] != row) {
+                        acc.denseOwner[j] = row;
+                        acc.dense[j] = 0.0;
+                        acc.touched.push_back(j);
+                    }
+                    acc.dense[j] += av * bm.values[l];
+                }
+            }
+            sort(acc.touched.begin(), acc.touched.end());
+            for (int j : acc.touched) {
+                if (acc.dense[j] != 0.0) {
+                    idx.push_back(j);
+                    values.push_back(acc.dense[j]);
+                }
+            }
+        } else {
+            size_t capacity = 16;
+            int capacityBits = 4;
+            while (capacity < 2 * flops) {
+                capacity <<= 1;
+                capacityBits++;
+            }
+            if (acc.hashKeys.size() < capacity) {
+                acc.hashKeys.assign(capacity, -1);
+                acc.hashValues.resize(capacity);
+            }
+            size_t mask = capacity - 1;
+            for (size_t k = am.ptr[i]; k < am.ptr[i + 1]; k++) {
+                int mid = am.idx[k];
+                double av = am.values[k];
+                for (size_t l = bm.ptr[mid]; l < bm.ptr[mid + 1]; l++) {
+                    int j = bm.idx[l];
+                    // Fibonacci hashing: the high bits of the product mix every bit of j
+                    size_t slot = (static_cast<uint64_t>(static_cast<uint32_t>(j)) * 0x9E3779B97F4A7C15ull) >>
+                                  (64 - capacityBits);
+                    while (acc.hashKeys[slot] != j && acc.hashKeys[slot] != -1) slot = (slot + 1) & mask;
+                    if (acc.hashKeys[slot] == -1) {
+                        acc.hashKeys[slot] = j;
+                        acc.hashValues[slot] = 0.0;
+                        acc.touched.push_back(static_cast<int>(slot));
+                    }
+                    acc.hashValues[slot] += av * bm.values[l];
+                }
+            }
+            for (int slot : acc.touched) {
+                acc.entries.emplace_back(acc.hashKeys[slot], acc.hashValues[slot]);
+                acc.hashKeys[slot] = -1;
+            }
+            sort(acc.entries.begin(), acc.entries.end(),
+                 [](const pair<int, double> &x, const pair<int, double> &y) { return x.first < y.first; });
+            for (const auto &entry : acc.entries) {
+                if (entry.second != 0.0) {
+                    idx.push_back(entry.first);
+                    values.push_back(entry.second);
+                }
+            }
+            acc.entries.clear();
+        }
+        acc.touched.clear();
+    };
+
+    return CSRMatrix(rows, cols, buildRowwise(work, bounds, produceRow));
+}
+
+// Function to add two sparse matrices (C = A + B) by merging their sorted rows
+CSRMatrix addSparse(const CSRMatrix &a, const CSRMatrix &b) {
+    if (a.rowCount() != b.rowCount() || a.colCount() != b.colCount()) {
+        throw invalid_argument("Cannot add: dimensions differ");
+    }
+    const CompressedMatrix &am = a.rowMajor();
+    const CompressedMatrix &bm = b.rowMajor();
+    int rows = a.rowCount();
+
+    vector<size_t> work(rows + 1);
+    for (int i = 0; i <= rows; i++) work[i] = am.ptr[i] + bm.ptr[i];
+
+    auto produceRow = [&](size_t i, size_t, vector<int> &idx, vector<double> &values) {
+        size_t p = am.ptr[i], pEnd = am.ptr[i + 1];
+        size_t q = bm.ptr[i], qEnd = bm.ptr[i + 1];
+        while (p < pEnd || q < qEnd) {
+            int j;
+            double sum;
+            if (q == qEnd || (p < pEnd && am.idx[p] < bm.idx[q])) {
+                j = am.idx[p];
+                sum = am.values[p++];
+            } else if (p == pEnd || bm.idx[q] < am.idx[p]) {
+                j = bm.idx[q];
+                sum = bm.values[q++];
+            } else {
+                j = am.idx[p];
+                sum = am.values[p++] + bm.values[q++];
+            }
+            if (sum != 0.0) {
+                idx.push_back(j);
+                values.push_back(sum);
+            }
+        }
+    };
+
+    return CSRMatrix(rows, a.colCount(), buildRowwise(work, splitBlocks(work), produceRow));
+}
+
+// Function to display CSR arrays and the row sums (A * ones)
+void printCSR(const CSRMatrix &csr) {
+    const CompressedMatrix &m = csr.rowMajor();
+    cout << "CSR Representation:" << endl;
+    cout << "Row Ptr -> ";
+    for (size_t val : m.ptr) cout << val << " ";
+    cout << endl;
+    cout << "Col Idx -> ";
+    for (int val : m.idx) cout << val << " ";
+    cout << endl;
+    cout << "Value   -> ";
+    for (double val : m.values) cout << val << " ";
+    cout << endl;
+
+    vector<double> ones(csr.colCount(), 1.0), rowSums;
+    csr.multiply(ones, rowSums);
+    cout << "Row sums -> ";
+    for (double val : rowSums) cout << val << " ";
+    cout << endl;
+}
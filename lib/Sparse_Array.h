@@ -0,0 +1,88 @@
+#ifndef SPARSE_ARRAY_H
+#define SPARSE_ARRAY_H
+
+// Array-based sparse matrices: the (row, column, value) triplet form produced
+// by generateSparse, and CSRMatrix, which keeps the same data in CSR and CSC
+// form for SpMV, sparse products, sums and transposes.
+
+#include <cstddef>
+#include <vector>
+
+#include "Sparse_Matrix_Loader.h"
+
+// Function to read a matrix from user input
+void readMatrix(int r, int c, std::vector<std::vector<int>> &mat);
+
+// Function to display a matrix
+void printMatrix(const std::vector<std::vector<int>> &mat);
+
+// Function to generate sparse matrix representation
+std::vector<std::vector<int>> generateSparse(const std::vector<std::vector<int>> &mat);
+
+// Function to display sparse matrix representation
+void printSparse(const std::vector<std::vector<int>> &sparse);
+
+// Compressed sparse storage: for CSR "major" is the row and "minor" the column,
+// for CSC it is the other way round.
+struct CompressedMatrix {
+    std::vector<size_t> ptr;    // ptr[i]..ptr[i+1] is the range of major index i
+    std::vector<int> idx;       // Minor index of every nonzero
+    std::vector<double> values; // Value of every nonzero
+};
+
+// Function to transpose compressed storage with a parallel counting sort.
+// Minor indices of the result come out sorted.
+CompressedMatrix transposeCompressed(const CompressedMatrix &m, int minorDim);
+
+// Sparse matrix kept in both CSR (row access, SpMV) and CSC (column access, transposed SpMV) form
+class CSRMatrix {
+private:
+    int rows, cols;
+    CompressedMatrix csr;
+    CompressedMatrix csc;
+
+    // Dot product of one compressed row with x, gathering x through idx
+    static double rowDot(const CompressedMatrix &m, size_t begin, size_t end, const double *x);
+
+    // y = M * x, with the major dimension split into blocks of roughly equal nonzero count
+    static void multiply(const CompressedMatrix &m, const std::vector<double> &x, std::vector<double> &y);
+
+    CSRMatrix(int r, int c, CompressedMatrix rowMajor, CompressedMatrix colMajor);
+
+public:
+    // Build from the (row, column, value) triplets produced by generateSparse
+    CSRMatrix(int r, int c, const std::vector<std::vector<int>> &sparse);
+
+    // Build from sorted, duplicate-free triplets such as those from loadSparseMatrix
+    explicit CSRMatrix(const SparseTriplets &m);
+
+    // Build from CSR arrays whose column indices are sorted within each row
+    CSRMatrix(int r, int c, CompressedMatrix rowMajor);
+
+    // A^T swaps the two stored forms, so it costs one copy and no sorting
+    CSRMatrix transposed() const;
+
+    int rowCount() const { return rows; }
+    int colCount() const { return cols; }
+    size_t nonZeroCount() const { return csr.idx.size(); }
+    const CompressedMatrix &rowMajor() const { return csr; }
+    const CompressedMatrix &colMajor() const { return csc; }
+
+    // y = A * x; throws std::invalid_argument unless x has one entry per column
+    void multiply(const std::vector<double> &x, std::vector<double> &y) const;
+
+    // y = A^T * x, computed through the CSC form; x needs one entry per row
+    void multiplyTransposed(const std::vector<double> &x, std::vector<double> &y) const;
+};
+
+// Function to multiply two sparse matrices (C = A * B) with Gustavson's row-wise
+// algorithm. Rows are split across threads by their flop count, not row count.
+CSRMatrix multiplySparse(const CSRMatrix &a, const CSRMatrix &b);
+
+// Function to add two sparse matrices (C = A + B) by merging their sorted rows
+CSRMatrix addSparse(const CSRMatrix &a, const CSRMatrix &b);
+
+// Function to display CSR arrays and the row sums (A * ones)
+void printCSR(const CSRMatrix &csr);
+
+#endif  // SPARSE_ARRAY_H
@@ -0,0 +1,182 @@
+#include "Sparse_Linked_List.h"
+#include "Instrumentation.h"
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+using namespace std;
+
+void SparseMatrix::ensureSize(int row, int col) {
+    if (row >= static_cast<int>(rowHead.size())) {
+        rowHead.resize(row + 1, nullptr);
+        rowTail.resize(row + 1, nullptr);
+        rowLength.resize(row + 1, 0);
+    }
+    if (col >= static_cast<int>(colHead.size())) {
+        colHead.resize(col + 1, nullptr);
+        colTail.resize(col + 1, nullptr);
+        colLength.resize(col + 1, 0);
+    }
+}
+
+bool SparseMatrix::inRange(int row, int col) const {
+    return row >= 0 && col >= 0 && row < static_cast<int>(rowHead.size()) && col < static_cast<int>(colHead.size());
+}
+
+void SparseMatrix::checkIndex(int row, int col) {
+    if (row < 0 || col < 0) {
+        throw out_of_range("Negative matrix index (" + to_string(row) + ", " + to_string(col) + ")");
+    }
+}
+
+Node* SparseMatrix::rowPredecessor(int row, int col) const {
+    Node* tail = rowTail[row];
+    if (tail && tail->col < col) return tail;
+    Node* prev = nullptr;
+    for (Node* temp = rowHead[row]; temp && temp->col < col; temp = temp->right) {
+        prev = temp;
+        INSTRUMENT_COUNT(ListTraversalStep, 1);
+    }
+    return prev;
+}
+
+Node* SparseMatrix::colPredecessor(int col, int row) const {
+    Node* tail = colTail[col];
+    if (tail && tail->row < row) return tail;
+    Node* prev = nullptr;
+    for (Node* temp = colHead[col]; temp && temp->row < row; temp = temp->down) {
+        prev = temp;
+        INSTRUMENT_COUNT(ListTraversalStep, 1);
+    }
+    return prev;
+}
+
+void SparseMatrix::insertAfter(Node* prevInRow, int row, int col, int value) {
+    Node* newNode = pool.allocate(row, col, value);
+
+    Node*& rowLink = prevInRow ? prevInRow->right : rowHead[row];
+    newNode->right = rowLink;
+    rowLink = newNode;
+    if (!newNode->right) rowTail[row] = newNode;
+
+    Node* prevInCol = colPredecessor(col, row);
+    Node*& colLink = prevInCol ? prevInCol->down : colHead[col];
+    newNode->down = colLink;
+    colLink = newNode;
+    if (!newNode->down) colTail[col] = newNode;
+
+    rowLength[row]++;
+    colLength[col]++;
+    count++;
+}
+
+void SparseMatrix::unlink(Node* node, Node* prevInRow) {
+    int row = node->row, col = node->col;
+
+    (prevInRow ? prevInRow->right : rowHead[row]) = node->right;
+    if (rowTail[row] == node) rowTail[row] = prevInRow;
+
+    Node* prevInCol = colPredecessor(col, row);
+    (prevInCol ? prevInCol->down : colHead[col]) = node->down;
+    if (colTail[col] == node) colTail[col] = prevInCol;
+
+    rowLength[row]--;
+    colLength[col]--;
+    count--;
+    pool.release(node);
+}
+
+SparseMatrix::SparseMatrix(int rows, int cols) : count(0) {
+    ensureSize(rows - 1, cols - 1);
+}
+
+void SparseMatrix::addElement(int row, int col, int value) {
+    checkIndex(row, col);
+    if (value == 0) return;
+    ensureSize(row, col);
+    Node* prev = rowPredecessor(row, col);
+    Node* temp = prev ? prev->right : rowHead[row];
+    if (temp && temp->col == col) {
+        temp->value += value;
+        if (temp->value == 0) unlink(temp, prev);
+    } else {
+        insertAfter(prev, row, col, value);
+    }
+}
+
+void SparseMatrix::setElement(int row, int col, int value) {
+    checkIndex(row, col);
+    if (value == 0) {
+        removeElement(row, col);
+        return;
+    }
+    ensureSize(row, col);
+    Node* prev = rowPredecessor(row, col);
+    Node* temp = prev ? prev->right : rowHead[row];
+    if (temp && temp->col == col) {
+        temp->value = value;
+    } else {
+        insertAfter(prev, row, col, value);
+    }
+}
+
+bool SparseMatrix::removeElement(int row, int col) {
+    if (!inRange(row, col)) return false;
+    Node* prev = rowPredecessor(row, col);
+    Node* temp = prev ? prev->right : rowHead[row];
+    if (!temp || temp->col != col) return false;
+    unlink(temp, prev);
+    return true;
+}
+
+int SparseMatrix::getElement(int row, int col) const {
+    if (!inRange(row, col)) return 0;
+    if (rowLength[row] <= colLength[col]) {
+        for (Node* temp = rowHead[row]; temp && temp->col <= col; temp = temp->right) {
+            INSTRUMENT_COUNT(ListTraversalStep, 1);
+            if (temp->col == col) return temp->value;
+        }
+    } else {
+        for (Node* temp = colHead[col]; temp && temp->row <= row; temp = temp->down) {
+            INSTRUMENT_COUNT(ListTraversalStep, 1);
+            if (temp->row == row) return temp->value;
+        }
+    }
+    return 0;
+}
+
+const Node* SparseMatrix::rowBegin(int row) const {
+    return row >= 0 && row < static_cast<int>(rowHead.size()) ? rowHead[row] : nullptr;
+}
+
+const Node* SparseMatrix::colBegin(int col) const {
+    return col >= 0 && col < static_cast<int>(colHead.size()) ? colHead[col] : nullptr;
+}
+
+void SparseMatrix::display() const {
+    for (Node* head : rowHead) {
+        for (Node* temp = head; temp; temp = temp->right) {
+            cout << "(" << temp->row << ", " << temp->col << ", " << temp->value << ") -> ";
+        }
+    }
+    cout << "NULL" << endl;
+}
+
+void convertToLinkedList(const vector<vector<int>>& matrix, SparseMatrix& sparseList) {
+    for (int i = 0; i < matrix.size(); ++i) {
+        for (int j = 0; j < matrix[i].size(); ++j) {
+            if (matrix[i][j] != 0) {
+                sparseList.addElement(i, j, matrix[i][j]);
+            }
+        }
+    }
+}
+
+// Function to fill the list from loaded triplets; values are rounded to the list's int values
+void convertToLinkedList(const SparseTriplets& triplets, SparseMatrix& sparseList) {
+    for (size_t k = 0; k < triplets.nnz; ++k) {
+        sparseList.addElement(triplets.rowIdx[k], triplets.colIdx[k], static_cast<int>(lround(triplets.values[k])));
+    }
+}
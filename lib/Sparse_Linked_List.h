@@ -0,0 +1,125 @@
+#ifndef SPARSE_LINKED_LIST_H
+#define SPARSE_LINKED_LIST_H
+
+// Linked-list sparse matrix: nodes come from a slab pool and are linked into
+// per-row and per-column lists.
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include "Sparse_Matrix_Loader.h"
+
+struct Node {
+    int row;
+    int col;
+    int value;
+    Node* right;  // Next nonzero in the same row
+    Node* down;   // Next nonzero in the same column
+
+    Node(int r, int c, int v) : row(r), col(c), value(v), right(nullptr), down(nullptr) {}
+};
+
+// Hands out nodes from fixed-size slabs and recycles released ones through a free list
+class NodePool {
+private:
+    static const size_t SLAB_SIZE = 4096;
+    std::vector<Node*> slabs;
+    size_t used;      // Nodes handed out from the newest slab
+    Node* freeList;   // Released nodes, chained through right
+
+public:
+    NodePool() : used(SLAB_SIZE), freeList(nullptr) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    Node* allocate(int row, int col, int value) {
+        void* memory;
+        if (freeList) {
+            memory = freeList;
+            freeList = freeList->right;
+        } else {
+            if (used == SLAB_SIZE) {
+                slabs.push_back(static_cast<Node*>(::operator new(SLAB_SIZE * sizeof(Node))));
+                used = 0;
+            }
+            memory = slabs.back() + used++;
+        }
+        return new (memory) Node(row, col, value);
+    }
+
+    void release(Node* node) {
+        node->right = freeList;
+        freeList = node;
+    }
+
+    ~NodePool() {
+        for (Node* slab : slabs) {
+            ::operator delete(slab);
+        }
+    }
+};
+
+// Orthogonal linked list: every nonzero sits in its row list (sorted by column)
+// and its column list (sorted by row). Lookups and updates walk one row or
+// column instead of the whole matrix, and row-major appends are O(1) through
+// the tail pointers.
+class SparseMatrix {
+private:
+    NodePool pool;
+    std::vector<Node*> rowHead, rowTail, colHead, colTail;
+    std::vector<int> rowLength, colLength;
+    size_t count;
+
+    void ensureSize(int row, int col);
+    bool inRange(int row, int col) const;
+
+    // Last node of the row with a column below col (nullptr if none)
+    Node* rowPredecessor(int row, int col) const;
+
+    // Last node of the column with a row below row (nullptr if none)
+    Node* colPredecessor(int col, int row) const;
+
+    // Throws std::out_of_range for a negative row or column
+    static void checkIndex(int row, int col);
+
+    void insertAfter(Node* prevInRow, int row, int col, int value);
+    void unlink(Node* node, Node* prevInRow);
+
+public:
+    SparseMatrix() : count(0) {}
+    SparseMatrix(int rows, int cols);
+
+    SparseMatrix(const SparseMatrix&) = delete;
+    SparseMatrix& operator=(const SparseMatrix&) = delete;
+
+    // Adds value to the entry at (row, col); the entry is removed if it becomes zero.
+    // The matrix grows to fit; negative indices throw std::out_of_range.
+    void addElement(int row, int col, int value);
+
+    // Sets the entry at (row, col); a zero value removes it. Grows like addElement.
+    void setElement(int row, int col, int value);
+
+    bool removeElement(int row, int col);
+
+    // Walks whichever of the row and column lists is shorter
+    int getElement(int row, int col) const;
+
+    // First nonzero of a row (follow right) or column (follow down)
+    const Node* rowBegin(int row) const;
+    const Node* colBegin(int col) const;
+
+    int rowCount() const { return static_cast<int>(rowHead.size()); }
+    int colCount() const { return static_cast<int>(colHead.size()); }
+    size_t nonZeroCount() const { return count; }
+
+    void display() const;
+};
+
+void convertToLinkedList(const std::vector<std::vector<int>>& matrix, SparseMatrix& sparseList);
+
+// Function to fill the list from loaded triplets; values are rounded to the list's int values
+void convertToLinkedList(const SparseTriplets& triplets, SparseMatrix& sparseList);
+
+#endif  // SPARSE_LINKED_LIST_H
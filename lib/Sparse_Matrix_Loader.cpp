@@ -0,0 +1,442 @@
+#include "Sparse_Matrix_Loader.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+SparseTriplets::SparseTriplets(const SparseTriplets &other)
+    : ownedRows(other.ownedRows), ownedCols(other.ownedCols), ownedValues(other.ownedValues),
+      mapping(other.mapping), rows(other.rows), cols(other.cols), nnz(other.nnz),
+      rowIdx(other.rowIdx), colIdx(other.colIdx), values(other.values) {
+    if (!mapping) {
+        rowIdx = ownedRows.data();
+        colIdx = ownedCols.data();
+        values = ownedValues.data();
+    }
+}
+
+SparseTriplets &SparseTriplets::operator=(const SparseTriplets &other) {
+    if (this != &other) *this = SparseTriplets(other);
+    return *this;
+}
+
+SparseTriplets makeSparseTriplets(int rows, int cols, std::vector<int> &&rowIdx,
+                                  std::vector<int> &&colIdx, std::vector<double> &&values) {
+    if (rows < 0 || cols < 0 || colIdx.size() != rowIdx.size() || values.size() != rowIdx.size()) {
+        throw std::invalid_argument("makeSparseTriplets: inconsistent dimensions or array lengths");
+    }
+    for (size_t k = 0; k < rowIdx.size(); ++k) {
+        bool inRange = rowIdx[k] >= 0 && rowIdx[k] < rows && colIdx[k] >= 0 && colIdx[k] < cols;
+        bool ordered = k == 0 || rowIdx[k - 1] < rowIdx[k] || (rowIdx[k - 1] == rowIdx[k] && colIdx[k - 1] < colIdx[k]);
+        if (!inRange || !ordered) {
+            throw std::invalid_argument("makeSparseTriplets: entries must be in range, sorted and duplicate-free");
+        }
+    }
+    SparseTriplets t;
+    t.ownedRows = std::move(rowIdx);
+    t.ownedCols = std::move(colIdx);
+    t.ownedValues = std::move(values);
+    t.rows = rows;
+    t.cols = cols;
+    t.nnz = t.ownedRows.size();
+    t.rowIdx = t.ownedRows.data();
+    t.colIdx = t.ownedCols.data();
+    t.values = t.ownedValues.data();
+    return t;
+}
+
+namespace {
+
+// Reads a file line by line through one reusable buffer
+class BufferedLineReader {
+private:
+    FILE *file;
+    std::vector<char> buffer;
+    size_t begin = 0, end = 0;
+    bool eof = false;
+
+    void refill() {
+        if (begin > 0) {
+            std::memmove(buffer.data(), buffer.data() + begin, end - begin);
+            end -= begin;
+            begin = 0;
+        }
+        if (end == buffer.size()) buffer.resize(buffer.size() * 2);  // Line longer than the buffer
+        size_t got = std::fread(buffer.data() + end, 1, buffer.size() - end, file);
+        if (got == 0) eof = true;
+        end += got;
+    }
+
+public:
+    explicit BufferedLineReader(const std::string &filePath, size_t bufferSize = 1 << 20)
+        : file(std::fopen(filePath.c_str(), "rb")), buffer(bufferSize) {
+        if (!file) throw std::runtime_error("Cannot open file: " + filePath);
+    }
+
+    ~BufferedLineReader() { std::fclose(file); }
+
+    BufferedLineReader(const BufferedLineReader &) = delete;
+    BufferedLineReader &operator=(const BufferedLineReader &) = delete;
+
+    // Sets [first, last) to the next line without its terminator
+    bool nextLine(const char *&first, const char *&last) {
+        while (true) {
+            const char *start = buffer.data() + begin;
+            const char *newline = static_cast<const char *>(std::memchr(start, '\n', end - begin));
+            if (newline) {
+                first = start;
+                last = newline;
+                begin = newline - buffer.data() + 1;
+                if (last > first && last[-1] == '\r') last--;
+                return true;
+            }
+            if (eof) {
+                if (begin == end) return false;
+                first = start;
+                last = buffer.data() + end;
+                begin = end;
+                return true;
+            }
+            refill();
+        }
+    }
+};
+
+const char *skipSpaces(const char *p, const char *last) {
+    while (p < last && (*p == ' ' || *p == '\t' || *p == ',')) p++;
+    return p;
+}
+
+template <typename T>
+bool parseNumber(const char *&p, const char *last, T &out) {
+    p = skipSpaces(p, last);
+    if (p < last && *p == '+') p++;
+    auto result = std::from_chars(p, last, out);
+    if (result.ec != std::errc()) return false;
+    p = result.ptr;
+    return true;
+}
+
+bool startsWith(const char *first, const char *last, const char *prefix) {
+    size_t n = std::strlen(prefix);
+    return static_cast<size_t>(last - first) >= n && std::memcmp(first, prefix, n) == 0;
+}
+
+bool contains(const char *first, const char *last, const char *word) {
+    return std::search(first, last, word, word + std::strlen(word)) != last;
+}
+
+std::string lineError(const std::string &filePath, size_t lineNo, const char *what) {
+    return filePath + ":" + std::to_string(lineNo) + ": " + what;
+}
+
+// Binary cache layout: header, int32 rows[nnz], int32 cols[nnz], double values[nnz].
+// The size and modification time of the source file identify what the cache was built from.
+struct SparseCacheHeader {
+    char magic[8];
+    uint32_t version;
+    int32_t rows;
+    int32_t cols;
+    uint32_t reserved;
+    uint64_t nnz;
+    uint64_t sourceSize;
+    int64_t sourceMtimeNs;
+};
+
+const char *sparseCacheMagic() { return "SPMCACHE"; }
+const uint32_t sparseCacheVersion = 2;
+
+// Size and nanosecond modification time of the file a cache was built from
+struct SourceIdentity {
+    uint64_t size = 0;
+    int64_t mtimeNs = 0;
+
+    bool operator==(const SourceIdentity &other) const { return size == other.size && mtimeNs == other.mtimeNs; }
+};
+
+// False if the file cannot be stat'ed
+bool sourceIdentity(const std::string &path, SourceIdentity &identity) {
+    struct stat st;
+    if (::stat(path.c_str(), &st) != 0) return false;
+    identity.size = st.st_size;
+    identity.mtimeNs = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+    return true;
+}
+
+void writeSparseCache(const SparseTriplets &m, const std::string &cachePath, const SourceIdentity &source) {
+    std::string tmpPath = cachePath + ".tmp";
+    std::unique_ptr<FILE, int (*)(FILE *)> file(std::fopen(tmpPath.c_str(), "wb"), std::fclose);
+    if (!file) throw std::runtime_error("Cannot write file: " + tmpPath);
+
+    SparseCacheHeader header{};
+    std::memcpy(header.magic, sparseCacheMagic(), sizeof(header.magic));
+    header.version = sparseCacheVersion;
+    header.rows = m.rows;
+    header.cols = m.cols;
+    header.nnz = m.nnz;
+    header.sourceSize = source.size;
+    header.sourceMtimeNs = source.mtimeNs;
+    bool ok = std::fwrite(&header, sizeof(header), 1, file.get()) == 1 &&
+              std::fwrite(m.rowIdx, sizeof(int), m.nnz, file.get()) == m.nnz &&
+              std::fwrite(m.colIdx, sizeof(int), m.nnz, file.get()) == m.nnz &&
+              std::fwrite(m.values, sizeof(double), m.nnz, file.get()) == m.nnz;
+    ok = std::fclose(file.release()) == 0 && ok;
+    if (!ok || std::rename(tmpPath.c_str(), cachePath.c_str()) != 0) {
+        std::remove(tmpPath.c_str());
+        throw std::runtime_error("Cannot write file: " + cachePath);
+    }
+}
+
+}  // namespace
+
+// Sort triplets by (row, column), sum duplicates and drop entries that end up zero.
+// Rows are bucketed with a counting sort; only each row's columns are sorted.
+SparseTriplets sortAndMerge(int rows, int cols, std::vector<int> &&rowIdx,
+                            std::vector<int> &&colIdx, std::vector<double> &&values) {
+    size_t nnz = rowIdx.size();
+    std::vector<size_t> rowPtr(rows + 1, 0);
+    for (int i : rowIdx) rowPtr[i + 1]++;
+    for (int i = 0; i < rows; i++) rowPtr[i + 1] += rowPtr[i];
+
+    std::vector<std::pair<int, double>> bucketed(nnz);
+    {
+        std::vector<size_t> next(rowPtr.begin(), rowPtr.end() - 1);
+        for (size_t k = 0; k < nnz; k++) {
+            bucketed[next[rowIdx[k]]++] = {colIdx[k], values[k]};
+        }
+    }
+
+    // Reuse the input arrays for the merged output; it is never longer than the input
+    size_t out = 0;
+    for (int i = 0; i < rows; i++) {
+        auto first = bucketed.begin() + rowPtr[i], last = bucketed.begin() + rowPtr[i + 1];
+        std::sort(first, last, [](const auto &a, const auto &b) { return a.first < b.first; });
+        for (auto it = first; it != last;) {
+            int col = it->first;
+            double sum = 0.0;
+            for (; it != last && it->first == col; ++it) sum += it->second;
+            if (sum != 0.0) {
+                rowIdx[out] = i;
+                colIdx[out] = col;
+                values[out] = sum;
+                out++;
+            }
+        }
+    }
+    std::vector<std::pair<int, double>>().swap(bucketed);
+    rowIdx.resize(out);
+    colIdx.resize(out);
+    values.resize(out);
+    rowIdx.shrink_to_fit();
+    colIdx.shrink_to_fit();
+    values.shrink_to_fit();
+    return makeSparseTriplets(rows, cols, std::move(rowIdx), std::move(colIdx), std::move(values));
+}
+
+// Matrix Market coordinate file: "%%MatrixMarket matrix coordinate <field> <symmetry>",
+// '%' comments, a "rows cols entries" size line, then 1-based "i j [value]" lines.
+SparseTriplets loadMatrixMarket(const std::string &filePath) {
+    BufferedLineReader reader(filePath);
+    const char *first, *last;
+    size_t lineNo = 1;
+
+    if (!reader.nextLine(first, last) || !startsWith(first, last, "%%MatrixMarket")) {
+        throw std::runtime_error(lineError(filePath, lineNo, "missing %%MatrixMarket header"));
+    }
+    if (!contains(first, last, "coordinate")) {
+        throw std::runtime_error(lineError(filePath, lineNo, "only coordinate format is supported"));
+    }
+    if (contains(first, last, "complex")) {
+        throw std::runtime_error(lineError(filePath, lineNo, "complex matrices are not supported"));
+    }
+    bool pattern = contains(first, last, "pattern");
+    bool skew = contains(first, last, "skew-symmetric");
+    bool symmetric = skew || contains(first, last, "symmetric") || contains(first, last, "hermitian");
+
+    long long rows = 0, cols = 0, entries = 0;
+    while (reader.nextLine(first, last)) {
+        lineNo++;
+        const char *p = skipSpaces(first, last);
+        if (p == last || *p == '%') continue;
+        if (!parseNumber(p, last, rows) || !parseNumber(p, last, cols) || !parseNumber(p, last, entries)) {
+            throw std::runtime_error(lineError(filePath, lineNo, "invalid size line"));
+        }
+        break;
+    }
+    if (rows <= 0 || cols <= 0 || rows > INT32_MAX || cols > INT32_MAX || entries < 0) {
+        throw std::runtime_error(lineError(filePath, lineNo, "invalid matrix dimensions"));
+    }
+
+    std::vector<int> rowIdx, colIdx;
+    std::vector<double> values;
+    size_t expected = static_cast<size_t>(entries) * (symmetric ? 2 : 1);
+    rowIdx.reserve(expected);
+    colIdx.reserve(expected);
+    values.reserve(expected);
+
+    long long entriesRead = 0;
+    while (reader.nextLine(first, last)) {
+        lineNo++;
+        const char *p = skipSpaces(first, last);
+        if (p == last || *p == '%') continue;
+        long long i, j;
+        double v = 1.0;
+        if (!parseNumber(p, last, i) || !parseNumber(p, last, j) || (!pattern && !parseNumber(p, last, v))) {
+            throw std::runtime_error(lineError(filePath, lineNo, "invalid entry"));
+        }
+        if (i < 1 || i > rows || j < 1 || j > cols) {
+            throw std::runtime_error(lineError(filePath, lineNo, "index out of range"));
+        }
+        if (++entriesRead > entries) {
+            throw std::runtime_error(lineError(filePath, lineNo, "more entries than the size line declares"));
+        }
+        rowIdx.push_back(static_cast<int>(i - 1));
+        colIdx.push_back(static_cast<int>(j - 1));
+        values.push_back(v);
+        if (symmetric && i != j) {
+            rowIdx.push_back(static_cast<int>(j - 1));
+            colIdx.push_back(static_cast<int>(i - 1));
+            values.push_back(skew ? -v : v);
+        }
+    }
+    if (entriesRead != entries) {
+        throw std::runtime_error(filePath + ": size line declares " + std::to_string(entries) +
+                                 " entries but the file has " + std::to_string(entriesRead));
+    }
+
+    return sortAndMerge(static_cast<int>(rows), static_cast<int>(cols),
+                        std::move(rowIdx), std::move(colIdx), std::move(values));
+}
+
+// Plain triplet file: 0-based "row col value" lines (the layout printed by
+// generateSparse), '#' comments. Dimensions are the largest indices plus one.
+SparseTriplets loadTriplets(const std::string &filePath) {
+    BufferedLineReader reader(filePath);
+    const char *first, *last;
+    size_t lineNo = 0;
+    int rows = 0, cols = 0;
+
+    std::vector<int> rowIdx, colIdx;
+    std::vector<double> values;
+    while (reader.nextLine(first, last)) {
+        lineNo++;
+        const char *p = skipSpaces(first, last);
+        if (p == last || *p == '#') continue;
+        int i, j;
+        double v;
+        if (!parseNumber(p, last, i) || !parseNumber(p, last, j) || !parseNumber(p, last, v)) {
+            throw std::runtime_error(lineError(filePath, lineNo, "invalid entry"));
+        }
+        if (i < 0 || j < 0 || i == INT32_MAX || j == INT32_MAX) {
+            throw std::runtime_error(lineError(filePath, lineNo, "index out of range"));
+        }
+        rows = std::max(rows, i + 1);
+        cols = std::max(cols, j + 1);
+        rowIdx.push_back(i);
+        colIdx.push_back(j);
+        values.push_back(v);
+    }
+
+    return sortAndMerge(rows, cols, std::move(rowIdx), std::move(colIdx), std::move(values));
+}
+
+void saveSparseCache(const SparseTriplets &m, const std::string &cachePath, const std::string &sourcePath) {
+    SourceIdentity source;
+    if (!sourcePath.empty() && !sourceIdentity(sourcePath, source)) {
+        throw std::runtime_error("Cannot open file: " + sourcePath);
+    }
+    writeSparseCache(m, cachePath, source);
+}
+
+SparseTriplets loadSparseCache(const std::string &cachePath, const std::string &sourcePath) {
+    int fd = ::open(cachePath.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error("Cannot open file: " + cachePath);
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(SparseCacheHeader)) {
+        ::close(fd);
+        throw std::runtime_error("Invalid sparse cache: " + cachePath);
+    }
+    size_t size = st.st_size;
+    void *base = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) throw std::runtime_error("Cannot map file: " + cachePath);
+
+    SparseTriplets t;
+    t.mapping = std::shared_ptr<void>(base, [size](void *p) { ::munmap(p, size); });
+
+    // nnz is bounded by the payload before it is multiplied, so a huge count cannot wrap around
+    const auto *header = static_cast<const SparseCacheHeader *>(base);
+    const size_t entryBytes = 2 * sizeof(int) + sizeof(double);
+    size_t payload = size - sizeof(SparseCacheHeader);
+    if (std::memcmp(header->magic, sparseCacheMagic(), sizeof(header->magic)) != 0 ||
+        header->version != sparseCacheVersion || header->rows < 0 || header->cols < 0 ||
+        header->nnz > payload / entryBytes || header->nnz * entryBytes != payload) {
+        throw std::runtime_error("Invalid sparse cache: " + cachePath);
+    }
+    if (!sourcePath.empty()) {
+        SourceIdentity source;
+        if (!sourceIdentity(sourcePath, source)) throw std::runtime_error("Cannot open file: " + sourcePath);
+        if (!(SourceIdentity{header->sourceSize, header->sourceMtimeNs} == source)) {
+            throw std::runtime_error("Stale sparse cache: " + cachePath);
+        }
+    }
+    ::madvise(base, size, MADV_SEQUENTIAL);
+
+    const char *data = static_cast<const char *>(base) + sizeof(SparseCacheHeader);
+    t.rows = header->rows;
+    t.cols = header->cols;
+    t.nnz = header->nnz;
+    t.rowIdx = reinterpret_cast<const int *>(data);
+    t.colIdx = t.rowIdx + t.nnz;
+    t.values = reinterpret_cast<const double *>(t.colIdx + t.nnz);
+
+    // Callers index dense row/column arrays with these, so a damaged cache must not get through
+    for (size_t k = 0; k < t.nnz; ++k) {
+        bool inRange = t.rowIdx[k] >= 0 && t.rowIdx[k] < t.rows && t.colIdx[k] >= 0 && t.colIdx[k] < t.cols;
+        bool ordered = k == 0 || t.rowIdx[k - 1] < t.rowIdx[k] ||
+                       (t.rowIdx[k - 1] == t.rowIdx[k] && t.colIdx[k - 1] < t.colIdx[k]);
+        if (!inRange || !ordered) throw std::runtime_error("Invalid sparse cache: " + cachePath);
+    }
+    return t;
+}
+
+// Load a .mtx or triplet file. With a cache path, a cache built from this exact
+// source (same size and modification time) is mapped instead of parsing, and a
+// missing, stale or damaged one is rewritten.
+SparseTriplets loadSparseMatrix(const std::string &filePath, const std::string &cachePath) {
+    // Taken before parsing: if the file is rewritten meanwhile, the cache is
+    // stamped with the old identity and rebuilt on the next load
+    SourceIdentity source;
+    if (!sourceIdentity(filePath, source)) throw std::runtime_error("Cannot open file: " + filePath);
+    struct stat cache;
+    if (!cachePath.empty() && ::stat(cachePath.c_str(), &cache) == 0) {
+        try {
+            return loadSparseCache(cachePath, filePath);
+        } catch (const std::runtime_error &) {
+            // Fall through and rebuild it
+        }
+    }
+
+    bool matrixMarket = filePath.size() >= 4 && filePath.compare(filePath.size() - 4, 4, ".mtx") == 0;
+    if (!matrixMarket) {
+        BufferedLineReader reader(filePath, 64);
+        const char *first, *last;
+        matrixMarket = reader.nextLine(first, last) && startsWith(first, last, "%%MatrixMarket");
+    }
+
+    SparseTriplets m = matrixMarket ? loadMatrixMarket(filePath) : loadTriplets(filePath);
+    if (!cachePath.empty()) writeSparseCache(m, cachePath, source);
+    return m;
+}
@@ -0,0 +1,72 @@
+#ifndef SPARSE_MATRIX_LOADER_H
+#define SPARSE_MATRIX_LOADER_H
+
+// Streaming loader for sparse matrices stored as Matrix Market (.mtx)
+// coordinate files or plain "row col value" triplet files. Entries are read
+// through a fixed-size buffer straight into triplet arrays, sorted by
+// (row, column) and merged, so memory grows with the number of nonzeros and
+// never with rows x cols. The result can be saved to a binary cache that is
+// mapped back with mmap on the next run.
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Sorted, duplicate-free (row, column, value) triplets. The arrays either live
+// in owned vectors or point into a memory-mapped cache file.
+class SparseTriplets {
+private:
+    std::vector<int> ownedRows, ownedCols;
+    std::vector<double> ownedValues;
+    std::shared_ptr<void> mapping;   // Keeps a mapped cache alive
+
+    friend SparseTriplets loadSparseCache(const std::string &cachePath, const std::string &sourcePath);
+    friend SparseTriplets makeSparseTriplets(int rows, int cols, std::vector<int> &&rowIdx,
+                                             std::vector<int> &&colIdx, std::vector<double> &&values);
+
+public:
+    SparseTriplets() = default;
+
+    // A copy owns copies of owned arrays and shares the mapping of mapped ones;
+    // moving keeps the arrays in place, so the pointers stay valid
+    SparseTriplets(const SparseTriplets &other);
+    SparseTriplets &operator=(const SparseTriplets &other);
+    SparseTriplets(SparseTriplets &&other) = default;
+    SparseTriplets &operator=(SparseTriplets &&other) = default;
+
+    int rows = 0;
+    int cols = 0;
+    size_t nnz = 0;
+    const int *rowIdx = nullptr;
+    const int *colIdx = nullptr;
+    const double *values = nullptr;
+};
+
+// Wrap arrays that are already sorted by (row, column), duplicate-free and within
+// rows x cols, as CSRMatrix and the list converters expect; throws
+// std::invalid_argument otherwise. Use sortAndMerge for arbitrary triplets.
+SparseTriplets makeSparseTriplets(int rows, int cols, std::vector<int> &&rowIdx,
+                                  std::vector<int> &&colIdx, std::vector<double> &&values);
+
+// Sort triplets by (row, column), sum duplicates and drop entries that end up zero
+SparseTriplets sortAndMerge(int rows, int cols, std::vector<int> &&rowIdx,
+                            std::vector<int> &&colIdx, std::vector<double> &&values);
+
+// Matrix Market coordinate file (general, symmetric, skew-symmetric or pattern)
+SparseTriplets loadMatrixMarket(const std::string &filePath);
+
+// Plain 0-based "row col value" file, '#' comments
+SparseTriplets loadTriplets(const std::string &filePath);
+
+// With a source path the cache records that file's size and modification time,
+// and loading rejects the cache unless they still match. Loading also checks
+// that every index is within rows x cols.
+void saveSparseCache(const SparseTriplets &m, const std::string &cachePath, const std::string &sourcePath = "");
+SparseTriplets loadSparseCache(const std::string &cachePath, const std::string &sourcePath = "");
+
+// Load a .mtx or triplet file. With a cache path, a cache built from this exact
+// source is mapped instead of parsing, and a missing, stale or damaged one is rewritten.
+SparseTriplets loadSparseMatrix(const std::string &filePath, const std::string &cachePath = "");
+
+#endif  // SPARSE_MATRIX_LOADER_H
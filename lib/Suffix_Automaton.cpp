@@ -0,0 +1,188 @@
+#include "Suffix_Automaton.h"
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <stdexcept>
+
+int GeneralizedSuffixAutomaton::getNext(int v, unsigned char c) const {
+    for (const auto& edge : states[v].next) {
+        if (edge.first == c) return edge.second;
+    }
+    return -1;
+}
+
+void GeneralizedSuffixAutomaton::setNext(int v, unsigned char c, int to) {
+    for (auto& edge : states[v].next) {
+        if (edge.first == c) {
+            edge.second = to;
+            return;
+        }
+    }
+    states[v].next.emplace_back(c, to);
+}
+
+int GeneralizedSuffixAutomaton::newState(int len, int endPos) {
+    states.push_back({len, -1, endPos, {}});
+    return static_cast<int>(states.size()) - 1;
+}
+
+int GeneralizedSuffixAutomaton::cloneState(int q, int len) {
+    State clone = states[q];
+    clone.len = len;
+    states.push_back(std::move(clone));
+    return static_cast<int>(states.size()) - 1;
+}
+
+void GeneralizedSuffixAutomaton::redirect(int p, unsigned char c, int q, int clone) {
+    for (; p != -1 && getNext(p, c) == q; p = states[p].link) {
+        setNext(p, c, clone);
+    }
+}
+
+int GeneralizedSuffixAutomaton::extend(int last, unsigned char c, int endPos) {
+    int q = getNext(last, c);
+    if (q != -1) {
+        // The prefix already exists from an earlier document
+        if (states[last].len + 1 == states[q].len) return q;
+        int clone = cloneState(q, states[last].len + 1);
+        redirect(last, c, q, clone);
+        states[q].link = clone;
+        return clone;
+    }
+
+    int cur = newState(states[last].len + 1, endPos);
+    int p = last;
+    while (p != -1 && getNext(p, c) == -1) {
+        setNext(p, c, cur);
+        p = states[p].link;
+    }
+    if (p == -1) {
+        states[cur].link = 0;
+        return cur;
+    }
+    q = getNext(p, c);
+    if (states[p].len + 1 == states[q].len) {
+        states[cur].link = q;
+    } else {
+        int clone = cloneState(q, states[p].len + 1);
+        redirect(p, c, q, clone);
+        states[q].link = clone;
+        states[cur].link = clone;
+    }
+    return cur;
+}
+
+// Walk up the suffix links from every prefix, stopping at states already
+// stamped by the current document.
+void GeneralizedSuffixAutomaton::countDocuments() {
+    std::vector<int> lastDoc(states.size(), -1);
+    docCount.assign(states.size(), 0);
+    for (size_t d = 0; d < docStart.size(); d++) {
+        size_t end = (d + 1 < docStart.size()) ? docStart[d + 1] : text.size();
+        for (size_t i = docStart[d]; i < end; i++) {
+            for (int v = prefixState[i]; v > 0 && lastDoc[v] != static_cast<int>(d); v = states[v].link) {
+                lastDoc[v] = static_cast<int>(d);
+                docCount[v]++;
+            }
+        }
+    }
+}
+
+// Every prefix contributes one end position, which is inherited by all its
+// suffix-link ancestors (processed by decreasing len).
+void GeneralizedSuffixAutomaton::countOccurrences() {
+    occurrences.assign(states.size(), 0);
+    for (int v : prefixState) occurrences[v]++;
+
+    int maxLen = 0;
+    for (const auto& s : states) maxLen = std::max(maxLen, s.len);
+    std::vector<int> bucket(maxLen + 1, 0);
+    for (const auto& s : states) bucket[s.len]++;
+    for (int i = 1; i <= maxLen; i++) bucket[i] += bucket[i - 1];
+    std::vector<int> order(states.size());
+    for (int v = static_cast<int>(states.size()) - 1; v >= 0; v--) {
+        order[--bucket[states[v].len]] = v;
+    }
+    for (int i = static_cast<int>(order.size()) - 1; i > 0; i--) {
+        int v = order[i];
+        if (states[v].link >= 0) occurrences[states[v].link] += occurrences[v];
+    }
+}
+
+std::string GeneralizedSuffixAutomaton::stateString(int v) const {
+    return text.substr(states[v].endPos - states[v].len + 1, states[v].len);
+}
+
+GeneralizedSuffixAutomaton::GeneralizedSuffixAutomaton(const std::vector<std::string>& documents) {
+    size_t total = 0;
+    for (const auto& doc : documents) total += doc.size();
+    text.reserve(total);
+    prefixState.reserve(total);
+    states.reserve(2 * total + 1);
+    newState(0, -1);
+
+    for (const auto& doc : documents) {
+        docStart.push_back(text.size());
+        int last = 0;
+        for (char ch : doc) {
+            int endPos = static_cast<int>(text.size());
+            text.push_back(ch);
+            last = extend(last, static_cast<unsigned char>(ch), endPos);
+            prefixState.push_back(last);
+        }
+    }
+
+    countDocuments();
+    countOccurrences();
+}
+
+GeneralizedSuffixAutomaton::Match GeneralizedSuffixAutomaton::longestShared(int k) const {
+    int best = 0;
+    for (size_t v = 1; v < states.size(); v++) {
+        if (docCount[v] >= k && states[v].len > states[best].len) best = static_cast<int>(v);
+    }
+    if (best == 0) return {"", 0, 0};
+    return {stateString(best), docCount[best], occurrences[best]};
+}
+
+std::vector<GeneralizedSuffixAutomaton::Match> GeneralizedSuffixAutomaton::topRepeated(size_t count, int minLen) const {
+    std::vector<int> candidates;
+    for (size_t v = 1; v < states.size(); v++) {
+        if (states[v].len < minLen || occurrences[v] < 2) continue;
+        // A transition keeping every occurrence means the string always extends by that character
+        bool rightMaximal = std::none_of(states[v].next.begin(), states[v].next.end(),
+            [&](const std::pair<unsigned char, int>& edge) { return occurrences[edge.second] == occurrences[v]; });
+        if (rightMaximal) candidates.push_back(static_cast<int>(v));
+    }
+    count = std::min(count, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + count, candidates.end(),
+        [this](int a, int b) {
+            if (occurrences[a] != occurrences[b]) return occurrences[a] > occurrences[b];
+            return states[a].len > states[b].len;
+        });
+
+    std::vector<Match> result;
+    for (size_t i = 0; i < count; i++) {
+        int v = candidates[i];
+        result.push_back({stateString(v), docCount[v], occurrences[v]});
+    }
+    return result;
+}
+
+// Every non-empty line of the corpus is one document
+std::vector<std::string> readDocuments(const std::string& filePath) {
+    std::ifstream file(filePath);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot open file: " + filePath);
+    }
+    std::vector<std::string> documents;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (!line.empty()) documents.push_back(line);
+    }
+    return documents;
+}
@@ -0,0 +1,73 @@
+#ifndef SUFFIX_AUTOMATON_H
+#define SUFFIX_AUTOMATON_H
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Generalized suffix automaton built once over every document of a corpus.
+// Each state keeps the number of documents containing its strings and the
+// total number of occurrences, so "longest substring shared by >= k documents"
+// and "most repeated substrings" are answered from the automaton directly
+// instead of running findLCS on every pair of documents.
+class GeneralizedSuffixAutomaton {
+private:
+    struct State {
+        int len;        // Length of the longest string in this state
+        int link;       // Suffix link
+        int endPos;     // End offset (in text) of one occurrence
+        std::vector<std::pair<unsigned char, int>> next;
+    };
+
+    std::vector<State> states;
+    std::string text;                    // All documents, back to back
+    std::vector<size_t> docStart;        // Offset of each document in text
+    std::vector<int> prefixState;        // State reached after each character of text
+    std::vector<int> docCount;           // Number of documents containing the state
+    std::vector<long long> occurrences;  // Number of occurrences of the state
+
+    int getNext(int v, unsigned char c) const;
+    void setNext(int v, unsigned char c, int to);
+    int newState(int len, int endPos);
+    int cloneState(int q, int len);
+
+    // Redirect the transitions on c from p and its suffix ancestors that point to q
+    void redirect(int p, unsigned char c, int q, int clone);
+
+    int extend(int last, unsigned char c, int endPos);
+
+    // Number of documents per state
+    void countDocuments();
+
+    // Number of occurrences per state
+    void countOccurrences();
+
+    std::string stateString(int v) const;
+
+public:
+    struct Match {
+        std::string substring;
+        int documents;
+        long long occurrences;
+    };
+
+    explicit GeneralizedSuffixAutomaton(const std::vector<std::string>& documents);
+
+    size_t documentCount() const { return docStart.size(); }
+    size_t stateCount() const { return states.size(); }
+
+    // Longest substring contained in at least k documents (empty if none)
+    Match longestShared(int k) const;
+
+    // The `count` most frequent repeated substrings of at least minLen characters.
+    // Only right-maximal ones are reported (not always followed by the same
+    // character), each by the longest string of its automaton state, so a
+    // repeat is not listed again as its own prefixes.
+    std::vector<Match> topRepeated(size_t count, int minLen) const;
+};
+
+// Every non-empty line of the corpus is one document
+std::vector<std::string> readDocuments(const std::string& filePath);
+
+#endif  // SUFFIX_AUTOMATON_H
@@ -0,0 +1,54 @@
+#include "Two_Sum.h"
+#include "Instrumentation.h"
+
+#include <vector>
+#include <unordered_map>
+#include <sstream>
+#include <regex>
+
+using namespace std;
+
+pair<int, int> twoSum(const vector<int>& arr, int target) {
+    INSTRUMENT_SCOPE("twoSum");
+    unordered_map<int, int> lookup;
+    for (int i = 0; i < arr.size(); ++i) {
+        int complement = target - arr[i];
+        INSTRUMENT_COUNT(HashProbe, 1);
+        if (lookup.find(complement) != lookup.end()) {
+            INSTRUMENT_COUNT(HashProbe, 1);
+            return {lookup[complement], i};
+        }
+        INSTRUMENT_COUNT(HashProbe, 1);
+        lookup[arr[i]] = i;
+    }
+    return {-1, -1}; 
+}
+
+// Improved regex to allow both space and comma as separators
+bool isValidInput(const string& input) {
+    regex pattern(R"(^\s*-?\d+(\s*[, ]\s*-?\d+)*\s*$)"); 
+    return regex_match(input, pattern);
+}
+
+vector<int> parseInput(const string& input) {
+    vector<int> result;
+    string cleanedInput;
+    
+    // Replace commas with spaces to standardize input
+    for (char c : input) {
+        if (c == ',') {
+            cleanedInput += ' ';
+        } else {
+            cleanedInput += c;
+        }
+    }
+
+    stringstream ss(cleanedInput);
+    int num;
+    
+    while (ss >> num) {
+        result.push_back(num);
+    }
+    
+    return result;
+}
@@ -0,0 +1,16 @@
+#ifndef TWO_SUM_H
+#define TWO_SUM_H
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// Indices of the first pair summing to target, {-1, -1} if there is none
+std::pair<int, int> twoSum(const std::vector<int>& arr, int target);
+
+// Improved regex to allow both space and comma as separators
+bool isValidInput(const std::string& input);
+
+std::vector<int> parseInput(const std::string& input);
+
+#endif  // TWO_SUM_H
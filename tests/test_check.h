@@ -0,0 +1,34 @@
+#ifndef TEST_CHECK_H
+#define TEST_CHECK_H
+
+// Minimal checks for the correctness tests run by ctest. A failed CHECK is
+// reported with its location and the test carries on; CHECK evaluates to the
+// condition so loops can stop early. main returns testResult(), which is
+// non-zero when any check failed.
+
+#include <iostream>
+
+inline int& testFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+inline bool checkResult(bool ok, const char* expression, const char* file, int line) {
+    if (!ok && ++testFailures() <= 20) {
+        std::cerr << file << ":" << line << ": check failed: " << expression << "\n";
+    }
+    return ok;
+}
+
+#define CHECK(...) checkResult(static_cast<bool>(__VA_ARGS__), #__VA_ARGS__, __FILE__, __LINE__)
+
+inline int testResult(const char* suite) {
+    if (testFailures() == 0) {
+        std::cout << suite << ": all checks passed\n";
+        return 0;
+    }
+    std::cout << suite << ": " << testFailures() << " checks failed\n";
+    return 1;
+}
+
+#endif  // TEST_CHECK_H
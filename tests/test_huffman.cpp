@@ -0,0 +1,58 @@
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Huffman_Codes.h"
+#include "test_check.h"
+
+using namespace std;
+
+// Cost of an optimal prefix code: the sum of every merge in Huffman's algorithm
+static long long optimalCost(const vector<int>& frequencies) {
+    priority_queue<long long, vector<long long>, greater<long long>> heap(frequencies.begin(), frequencies.end());
+    long long cost = 0;
+    while (heap.size() > 1) {
+        long long a = heap.top(); heap.pop();
+        long long b = heap.top(); heap.pop();
+        cost += a + b;
+        heap.push(a + b);
+    }
+    return cost;
+}
+
+int main() {
+    mt19937 rng(11);
+    const string alphabet = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    for (int iteration = 0; iteration < 500; iteration++) {
+        string symbols = alphabet;
+        shuffle(symbols.begin(), symbols.end(), rng);
+        symbols.resize(2 + rng() % (alphabet.size() - 1));
+        vector<int> frequencies(symbols.size());
+        for (int& f : frequencies) f = 1 + rng() % 100;
+
+        unordered_map<char, string> codes = buildHuffmanTree(symbols, frequencies);
+        if (!CHECK(codes.size() == symbols.size())) continue;
+
+        long long cost = 0;
+        for (size_t i = 0; i < symbols.size(); i++) {
+            const string& code = codes[symbols[i]];
+            CHECK(!code.empty());
+            cost += static_cast<long long>(frequencies[i]) * code.size();
+            for (size_t j = 0; j < symbols.size(); j++) {
+                const string& other = codes[symbols[j]];
+                if (i != j) CHECK(other.compare(0, code.size(), code) != 0);  // Prefix-free
+            }
+        }
+        CHECK(cost == optimalCost(frequencies));
+    }
+
+    vector<int> parsed;
+    CHECK(isValidFrequencyInput("5 9 12", parsed, 3) && parsed == vector<int>({5, 9, 12}));
+    CHECK(!isValidFrequencyInput("5 9", parsed, 3));
+    CHECK(isValidCharacterSet("abcXYZ") && !isValidCharacterSet("ab1"));
+    return testResult("huffman");
+}
@@ -0,0 +1,38 @@
+#include <random>
+#include <string>
+
+#include "LCS.h"
+#include "test_check.h"
+
+using namespace std;
+
+int main() {
+    mt19937 rng(17);
+    for (int iteration = 0; iteration < 2000; iteration++) {
+        // findLCS compares strings of equal length
+        size_t n = 1 + rng() % 20;
+        string s1, s2;
+        for (size_t i = 0; i < n; i++) {
+            s1 += static_cast<char>('A' + rng() % 3);
+            s2 += static_cast<char>('A' + rng() % 3);
+        }
+
+        size_t best = 0;
+        for (size_t i = 0; i < n; i++) {
+            for (size_t len = best + 1; i + len <= n; len++) {
+                if (s2.find(s1.substr(i, len)) == string::npos) break;
+                best = len;
+            }
+        }
+
+        int len = -1;
+        string found = findLCS(s1, s2, len, false);
+        CHECK(len == static_cast<int>(best) && found.size() == best);
+        CHECK(s1.find(found) != string::npos && s2.find(found) != string::npos);
+    }
+
+    string word = "MixedCase";
+    toUpper(word);
+    CHECK(word == "MIXEDCASE" && isAlpha(word) && !isAlpha("AB1"));
+    return testResult("lcs");
+}
@@ -0,0 +1,31 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "SecureHash256.h"
+#include "test_check.h"
+
+using namespace std;
+
+int main() {
+    // FIPS 180-2 test vectors, covering one, two and many blocks
+    CHECK(SecureHash256::hash("") == "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    CHECK(SecureHash256::hash("abc") == "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    CHECK(SecureHash256::hash("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+          "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+    CHECK(SecureHash256::hash(string(1000000, 'a')) ==
+          "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+
+    // Lengths around the 55/56/64-byte padding boundaries agree between the string and file paths
+    const string path = "test_sha256.bin";
+    for (size_t length = 50; length <= 130; length++) {
+        string message(length, static_cast<char>('a' + length % 26));
+        {
+            ofstream out(path, ios::binary);
+            out << message;
+        }
+        CHECK(SecureHash256::hashFile(path) == SecureHash256::hash(message));
+    }
+    remove(path.c_str());
+    return testResult("sha256");
+}
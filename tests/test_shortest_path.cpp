@@ -0,0 +1,104 @@
+#include <climits>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Dijkstra_Graph.h"
+#include "test_check.h"
+
+using namespace std;
+
+static string nodeName(int i) {
+    return "N" + to_string(i);
+}
+
+// A returned path must start and end at the query nodes and its edges must add up to cost
+static bool validPath(const map<pair<int, int>, int>& edges, const vector<string>& path, int source, int target,
+                      int cost) {
+    if (path.empty() || path.front() != nodeName(source) || path.back() != nodeName(target)) return false;
+    long long sum = 0;
+    for (size_t i = 0; i + 1 < path.size(); i++) {
+        auto it = edges.find({stoi(path[i].substr(1)), stoi(path[i + 1].substr(1))});
+        if (it == edges.end()) return false;
+        sum += it->second;
+    }
+    return sum == cost;
+}
+
+// Random batches of edge additions, reweights and removals; after every batch
+// the repaired trees of two tracked sources must agree with a fresh Dijkstra run
+int main() {
+    mt19937 rng(31);
+    for (int graphIndex = 0; graphIndex < 300; graphIndex++) {
+        int n = 2 + rng() % 25;
+        Graph graph;
+        map<pair<int, int>, int> edges;   // Reference edge set, one edge per node pair
+        for (int e = 0; e < 2 * n; e++) {
+            int a = rng() % n, b = rng() % n, w = 1 + rng() % 20;
+            graph.updateEdge(nodeName(a), nodeName(b), w);
+            edges[{a, b}] = w;
+        }
+        vector<int> sources = {0, static_cast<int>(rng() % n)};
+        for (int s : sources) graph.trackSource(nodeName(s));
+
+        bool ok = true;
+        for (int batch = 0; batch < 30 && ok; batch++) {
+            int changes = 1 + rng() % 5;
+            for (int c = 0; c < changes; c++) {
+                int a = rng() % n, b = rng() % n;
+                switch (rng() % 3) {
+                case 0: {
+                    int w = 1 + rng() % 20;
+                    graph.updateEdge(nodeName(a), nodeName(b), w);
+                    edges[{a, b}] = w;
+                    break;
+                }
+                case 1:
+                    if (!edges.empty()) {
+                        auto it = next(edges.begin(), rng() % edges.size());
+                        a = it->first.first;
+                        b = it->first.second;
+                    }
+                    CHECK(graph.removeEdge(nodeName(a), nodeName(b)) == (edges.erase({a, b}) == 1));
+                    break;
+                default:
+                    if (edges.count({a, b})) break;
+                    edges[{a, b}] = 1 + rng() % 20;
+                    graph.addEdge(nodeName(a), nodeName(b), edges[{a, b}]);
+                }
+            }
+
+            for (int s : sources) {
+                for (int t = 0; t < n && ok; t++) {
+                    auto [cost, path] = graph.trackedPath(nodeName(s), nodeName(t));
+                    auto [expectedCost, expectedPath] = graph.dijkstra(nodeName(s), nodeName(t));
+                    ok = CHECK(cost == expectedCost);
+                    if (ok && cost != INT_MAX) {
+                        ok = CHECK(validPath(edges, path, s, t, cost)) && CHECK(validPath(edges, expectedPath, s, t, cost));
+                    }
+                }
+            }
+        }
+
+        // With nothing tracked the incoming edges are dropped; edits made meanwhile
+        // must be seen when they are rebuilt for the next tracked source
+        for (int s : sources) graph.untrackSource(nodeName(s));
+        for (int c = 0; c < 5; c++) {
+            int a = rng() % n, b = rng() % n, w = 1 + rng() % 20;
+            graph.updateEdge(nodeName(a), nodeName(b), w);
+            edges[{a, b}] = w;
+        }
+        graph.trackSource(nodeName(0));
+        for (int t = 0; t < n; t++) {
+            graph.removeEdge(nodeName(t), nodeName((t + 1) % n));
+            edges.erase({t, (t + 1) % n});
+        }
+        for (int t = 0; t < n && ok; t++) {
+            ok = CHECK(graph.trackedPath(nodeName(0), nodeName(t)).first == graph.dijkstra(nodeName(0), nodeName(t)).first);
+        }
+        if (!ok) break;
+    }
+    return testResult("shortest_path");
+}
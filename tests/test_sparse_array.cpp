@@ -0,0 +1,145 @@
+#include <cmath>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Sparse_Array.h"
+#include "test_check.h"
+
+using namespace std;
+
+using Dense = vector<vector<double>>;
+
+// Random matrix in the generateSparse triplet layout with distinct positions
+// and nonzero values; strided draws columns from multiples of stride
+static vector<vector<int>> randomTriplets(int rows, int cols, size_t nnz, mt19937& rng, int stride = 1) {
+    vector<vector<int>> sparse(3);
+    set<pair<int, int>> seen;
+    for (size_t k = 0; k < nnz; k++) {
+        int i = rng() % rows;
+        int j = static_cast<int>((rng() % ((cols + stride - 1) / stride)) * stride);
+        if (!seen.insert({i, j}).second) continue;
+        int v = static_cast<int>(rng() % 9) - 4;
+        sparse[0].push_back(i);
+        sparse[1].push_back(j);
+        sparse[2].push_back(v == 0 ? 5 : v);
+    }
+    return sparse;
+}
+
+// Expands a matrix and checks that both stored forms are well formed and agree
+static Dense toDense(const CSRMatrix& m) {
+    Dense fromRows(m.rowCount(), vector<double>(m.colCount(), 0.0));
+    const CompressedMatrix& csr = m.rowMajor();
+    CHECK(csr.ptr.size() == static_cast<size_t>(m.rowCount()) + 1);
+    for (int i = 0; i < m.rowCount(); i++) {
+        for (size_t k = csr.ptr[i]; k < csr.ptr[i + 1]; k++) {
+            CHECK(k == csr.ptr[i] || csr.idx[k - 1] < csr.idx[k]);
+            CHECK(csr.values[k] != 0.0);
+            fromRows[i][csr.idx[k]] = csr.values[k];
+        }
+    }
+    Dense fromCols(m.rowCount(), vector<double>(m.colCount(), 0.0));
+    const CompressedMatrix& csc = m.colMajor();
+    CHECK(csc.ptr.size() == static_cast<size_t>(m.colCount()) + 1);
+    for (int j = 0; j < m.colCount(); j++) {
+        for (size_t k = csc.ptr[j]; k < csc.ptr[j + 1]; k++) {
+            CHECK(k == csc.ptr[j] || csc.idx[k - 1] < csc.idx[k]);
+            fromCols[csc.idx[k]][j] = csc.values[k];
+        }
+    }
+    CHECK(fromRows == fromCols);
+    return fromRows;
+}
+
+static bool near(double a, double b) {
+    return fabs(a - b) <= 1e-9 * max(1.0, fabs(a));
+}
+
+// C = A * B, A + A2, A^T and both SpMVs against dense arithmetic
+static void checkOperations(int rows, int inner, int cols, size_t nnzA, size_t nnzB, mt19937& rng, int stride = 1) {
+    CSRMatrix a(rows, inner, randomTriplets(rows, inner, nnzA, rng));
+    CSRMatrix a2(rows, inner, randomTriplets(rows, inner, nnzA, rng));
+    CSRMatrix b(inner, cols, randomTriplets(inner, cols, nnzB, rng, stride));
+    Dense da = toDense(a), da2 = toDense(a2), db = toDense(b);
+
+    Dense expected(rows, vector<double>(cols, 0.0));
+    for (int i = 0; i < rows; i++) {
+        for (int l = 0; l < inner; l++) {
+            if (da[i][l] == 0.0) continue;
+            for (int j = 0; j < cols; j++) expected[i][j] += da[i][l] * db[l][j];
+        }
+    }
+    Dense product = toDense(multiplySparse(a, b));
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            if (!CHECK(near(product[i][j], expected[i][j]))) return;
+        }
+    }
+
+    Dense sum = toDense(addSparse(a, a2));
+    Dense transposed = toDense(a.transposed());
+    for (int i = 0; i < rows; i++) {
+        for (int l = 0; l < inner; l++) {
+            if (!CHECK(sum[i][l] == da[i][l] + da2[i][l])) return;
+            if (!CHECK(transposed[l][i] == da[i][l])) return;
+        }
+    }
+
+    vector<double> x(inner), xt(rows), y, yt;
+    for (double& v : x) v = static_cast<int>(rng() % 21) - 10;
+    for (double& v : xt) v = static_cast<int>(rng() % 21) - 10;
+    a.multiply(x, y);
+    a.multiplyTransposed(xt, yt);
+    CHECK(y.size() == static_cast<size_t>(rows) && yt.size() == static_cast<size_t>(inner));
+    for (int i = 0; i < rows; i++) {
+        double want = 0.0;
+        for (int l = 0; l < inner; l++) want += da[i][l] * x[l];
+        CHECK(near(y[i], want));
+    }
+    for (int l = 0; l < inner; l++) {
+        double want = 0.0;
+        for (int i = 0; i < rows; i++) want += da[i][l] * xt[i];
+        CHECK(near(yt[l], want));
+    }
+}
+
+int main() {
+    mt19937 rng(2024);
+
+    // Small shapes, including empty rows and columns
+    for (int iteration = 0; iteration < 200; iteration++) {
+        int rows = 1 + rng() % 30, inner = 1 + rng() % 30, cols = 1 + rng() % 60;
+        checkOperations(rows, inner, cols, rng() % (rows * inner + 1), rng() % (inner * cols + 1), rng);
+    }
+
+    // Large enough to be split across threads
+    checkOperations(600, 600, 600, 120000, 120000, rng);
+
+    // Wide output with few flops per row takes the hash accumulator, here with
+    // columns on a power-of-two stride
+    checkOperations(40, 40, 1 << 16, 200, 2000, rng, 4096);
+    checkOperations(40, 40, 1 << 16, 200, 2000, rng);
+
+    // Build from loader triplets
+    SparseTriplets triplets = makeSparseTriplets(3, 4, {0, 1, 2}, {3, 0, 2}, {1.5, -2.0, 4.0});
+    Dense fromTriplets = toDense(CSRMatrix(triplets));
+    CHECK(fromTriplets[0][3] == 1.5 && fromTriplets[1][0] == -2.0 && fromTriplets[2][2] == 4.0);
+
+    // SpMV rejects vectors of the wrong length instead of reading past them
+    CSRMatrix wide(2, 4, randomTriplets(2, 4, 6, rng));
+    vector<double> shortX(2, 1.0), longX(4, 1.0), y;
+    for (auto [x, transposed] : {pair<vector<double>*, bool>{&shortX, false}, {&longX, true}}) {
+        bool threw = false;
+        try {
+            if (transposed) wide.multiplyTransposed(*x, y); else wide.multiply(*x, y);
+        } catch (const invalid_argument&) {
+            threw = true;
+        }
+        CHECK(threw);
+    }
+
+    return testResult("sparse_array");
+}
@@ -0,0 +1,83 @@
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Sparse_Linked_List.h"
+#include "test_check.h"
+
+using namespace std;
+
+// Every row and column list must be sorted and hold exactly the reference entries
+static bool matchesReference(const SparseMatrix& m, const map<pair<int, int>, int>& ref) {
+    vector<pair<pair<int, int>, int>> byRows, byCols;
+    for (int i = 0; i < m.rowCount(); i++) {
+        int previous = -1;
+        for (const Node* node = m.rowBegin(i); node; node = node->right) {
+            if (!CHECK(node->row == i && node->col > previous)) return false;
+            previous = node->col;
+            byRows.push_back({{node->row, node->col}, node->value});
+        }
+    }
+    for (int j = 0; j < m.colCount(); j++) {
+        int previous = -1;
+        for (const Node* node = m.colBegin(j); node; node = node->down) {
+            if (!CHECK(node->col == j && node->row > previous)) return false;
+            previous = node->row;
+            auto it = ref.find({node->row, node->col});
+            if (!CHECK(it != ref.end() && it->second == node->value)) return false;
+        }
+    }
+    return CHECK(byRows == vector<pair<pair<int, int>, int>>(ref.begin(), ref.end()));
+}
+
+int main() {
+    mt19937 rng(5);
+    SparseMatrix m;
+    map<pair<int, int>, int> ref;
+
+    for (int step = 0; step < 100000; step++) {
+        int row = rng() % 30, col = rng() % 30, value = static_cast<int>(rng() % 7) - 3;
+        switch (rng() % 4) {
+        case 0:
+            m.addElement(row, col, value);
+            if ((ref[{row, col}] += value) == 0) ref.erase({row, col});
+            break;
+        case 1:
+            m.setElement(row, col, value);
+            if (value != 0) ref[{row, col}] = value; else ref.erase({row, col});
+            break;
+        case 2:
+            CHECK(m.removeElement(row, col) == (ref.erase({row, col}) == 1));
+            break;
+        default: {
+            auto it = ref.find({row, col});
+            CHECK(m.getElement(row, col) == (it == ref.end() ? 0 : it->second));
+        }
+        }
+        if (!CHECK(m.nonZeroCount() == ref.size())) break;
+        if (step % 1000 == 0 && !matchesReference(m, ref)) break;
+    }
+    matchesReference(m, ref);
+
+    bool threw = false;
+    try {
+        m.addElement(-1, 0, 1);
+    } catch (const out_of_range&) {
+        threw = true;
+    }
+    CHECK(threw);
+    CHECK(m.getElement(-1, 0) == 0 && !m.removeElement(0, -1));
+
+    SparseMatrix sized(5, 7);
+    CHECK(sized.rowCount() == 5 && sized.colCount() == 7);
+
+    SparseTriplets triplets = makeSparseTriplets(4, 6, {0, 2}, {5, 1}, {2.4, -3.6});
+    SparseMatrix loaded(triplets.rows, triplets.cols);
+    convertToLinkedList(triplets, loaded);
+    CHECK(loaded.rowCount() == 4 && loaded.colCount() == 6);
+    CHECK(loaded.getElement(0, 5) == 2 && loaded.getElement(2, 1) == -4 && loaded.nonZeroCount() == 2);
+
+    return testResult("sparse_list");
+}
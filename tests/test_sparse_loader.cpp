@@ -0,0 +1,159 @@
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Sparse_Matrix_Loader.h"
+#include "test_check.h"
+
+using namespace std;
+
+using Entries = map<pair<int, int>, double>;
+
+static bool matches(const SparseTriplets& m, int rows, int cols, const Entries& expected) {
+    if (!CHECK(m.rows == rows && m.cols == cols && m.nnz == expected.size())) return false;
+    size_t k = 0;
+    for (const auto& [position, value] : expected) {
+        if (!CHECK(m.rowIdx[k] == position.first && m.colIdx[k] == position.second && m.values[k] == value)) {
+            return false;
+        }
+        k++;
+    }
+    return true;
+}
+
+int main() {
+    mt19937 rng(3);
+    const string mtxPath = "test_sparse_loader.mtx";
+    const string tripletPath = "test_sparse_loader.txt";
+    const string cachePath = "test_sparse_loader.cache";
+
+    // General Matrix Market file with duplicates, which are summed
+    for (int iteration = 0; iteration < 50; iteration++) {
+        int rows = 1 + rng() % 40, cols = 1 + rng() % 40, entries = rng() % 200;
+        Entries expected;
+        {
+            ofstream out(mtxPath);
+            out << "%%MatrixMarket matrix coordinate real general\n% comment\n";
+            out << rows << " " << cols << " " << entries << "\n";
+            for (int e = 0; e < entries; e++) {
+                int i = rng() % rows, j = rng() % cols, v = static_cast<int>(rng() % 7) - 3;
+                out << i + 1 << " " << j + 1 << " " << v << "\n";
+                expected[{i, j}] += v;
+            }
+        }
+        for (auto it = expected.begin(); it != expected.end();) {
+            it = it->second == 0.0 ? expected.erase(it) : next(it);
+        }
+        if (!matches(loadMatrixMarket(mtxPath), rows, cols, expected)) break;
+    }
+
+    // Symmetric storage mirrors the off-diagonal entries
+    {
+        ofstream out(mtxPath);
+        out << "%%MatrixMarket matrix coordinate real symmetric\n3 3 2\n1 1 4\n3 1 2.5\n";
+    }
+    matches(loadMatrixMarket(mtxPath), 3, 3, {{{0, 0}, 4.0}, {{0, 2}, 2.5}, {{2, 0}, 2.5}});
+
+    // Triplet files are 0-based, dimensions come from the largest indices
+    {
+        ofstream out(tripletPath);
+        out << "# row col value\n2 1 1.5\n0 3 -2\n2 1 0.5\n";
+    }
+    matches(loadTriplets(tripletPath), 3, 4, {{{0, 3}, -2.0}, {{2, 1}, 2.0}});
+
+    // Cache round trip, then a rewritten source must not be served from the old cache
+    remove(cachePath.c_str());
+    matches(loadSparseMatrix(tripletPath, cachePath), 3, 4, {{{0, 3}, -2.0}, {{2, 1}, 2.0}});
+    SparseTriplets cached = loadSparseMatrix(tripletPath, cachePath);
+    matches(cached, 3, 4, {{{0, 3}, -2.0}, {{2, 1}, 2.0}});
+    {
+        ofstream out(tripletPath);
+        out << "1 1 7\n";
+    }
+    matches(loadSparseMatrix(tripletPath, cachePath), 2, 2, {{{1, 1}, 7.0}});
+
+    // A damaged index is rejected by loadSparseCache and rebuilt by loadSparseMatrix
+    {
+        fstream file(cachePath, ios::in | ios::out | ios::binary);
+        file.seekp(-static_cast<streamoff>(2 * sizeof(int) + sizeof(double)), ios::end);
+        int bad = 1000;
+        file.write(reinterpret_cast<const char*>(&bad), sizeof(bad));
+    }
+    bool rejected = false;
+    try {
+        loadSparseCache(cachePath);
+    } catch (const runtime_error&) {
+        rejected = true;
+    }
+    CHECK(rejected);
+    matches(loadSparseMatrix(tripletPath, cachePath), 2, 2, {{{1, 1}, 7.0}});
+
+    // A header-only cache whose entry count makes nnz * 16 wrap around to zero
+    {
+        fstream file(cachePath, ios::in | ios::out | ios::binary);
+        file.seekp(24);
+        uint64_t hugeCount = uint64_t(1) << 60;
+        file.write(reinterpret_cast<const char*>(&hugeCount), sizeof(hugeCount));
+    }
+    filesystem::resize_file(cachePath, 48);
+    rejected = false;
+    try {
+        loadSparseCache(cachePath);
+    } catch (const runtime_error&) {
+        rejected = true;
+    }
+    CHECK(rejected);
+    matches(loadSparseMatrix(tripletPath, cachePath), 2, 2, {{{1, 1}, 7.0}});
+
+    // The entry count on the size line must match the entries in the file
+    for (const char* body : {"2 2 3\n1 1 1\n2 2 1\n", "2 2 1\n1 1 1\n2 2 1\n"}) {
+        {
+            ofstream out(mtxPath);
+            out << "%%MatrixMarket matrix coordinate real general\n" << body;
+        }
+        rejected = false;
+        try {
+            loadMatrixMarket(mtxPath);
+        } catch (const runtime_error&) {
+            rejected = true;
+        }
+        CHECK(rejected);
+    }
+
+    // makeSparseTriplets only wraps sorted, duplicate-free, in-range entries
+    for (auto [rowIdx, colIdx] : {pair<vector<int>, vector<int>>{{1, 0}, {0, 0}}, {{0, 0}, {1, 1}}, {{0, 2}, {0, 0}}}) {
+        rejected = false;
+        try {
+            makeSparseTriplets(2, 2, std::move(rowIdx), std::move(colIdx), {1.0, 2.0});
+        } catch (const invalid_argument&) {
+            rejected = true;
+        }
+        CHECK(rejected);
+    }
+
+    // Copies stay valid after the original is gone, for owned and mapped data
+    SparseTriplets ownedCopy(makeSparseTriplets(2, 2, {0, 1}, {1, 0}, {1.0, 2.0}));
+    {
+        SparseTriplets original = makeSparseTriplets(2, 2, {0}, {0}, {9.0});
+        ownedCopy = original;
+    }
+    matches(ownedCopy, 2, 2, {{{0, 0}, 9.0}});
+    SparseTriplets mappedCopy;
+    {
+        SparseTriplets original = loadSparseCache(cachePath);
+        mappedCopy = original;
+    }
+    matches(mappedCopy, 2, 2, {{{1, 1}, 7.0}});
+
+    remove(mtxPath.c_str());
+    remove(tripletPath.c_str());
+    remove(cachePath.c_str());
+    return testResult("sparse_loader");
+}
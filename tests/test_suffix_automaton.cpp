@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Suffix_Automaton.h"
+#include "test_check.h"
+
+using namespace std;
+
+static int documentsContaining(const vector<string>& documents, const string& s) {
+    int count = 0;
+    for (const string& d : documents) {
+        if (d.find(s) != string::npos) count++;
+    }
+    return count;
+}
+
+static long long occurrencesOf(const vector<string>& documents, const string& s) {
+    long long count = 0;
+    for (const string& d : documents) {
+        for (size_t p = d.find(s); p != string::npos; p = d.find(s, p + 1)) count++;
+    }
+    return count;
+}
+
+// Every query answered by the automaton is compared with brute force over all substrings
+static void checkCorpus(const vector<string>& documents) {
+    GeneralizedSuffixAutomaton automaton(documents);
+    CHECK(automaton.documentCount() == documents.size());
+
+    for (int k = 1; k <= static_cast<int>(documents.size()); k++) {
+        size_t best = 0;
+        for (const string& d : documents) {
+            for (size_t i = 0; i < d.size(); i++) {
+                for (size_t len = best + 1; i + len <= d.size(); len++) {
+                    if (documentsContaining(documents, d.substr(i, len)) >= k) best = len;
+                }
+            }
+        }
+        GeneralizedSuffixAutomaton::Match match = automaton.longestShared(k);
+        if (!CHECK(match.substring.size() == best)) return;
+        if (best > 0) {
+            CHECK(match.documents == documentsContaining(documents, match.substring));
+            CHECK(match.documents >= k);
+            CHECK(match.occurrences == occurrencesOf(documents, match.substring));
+        }
+    }
+
+    int minLen = 1 + static_cast<int>(documents.size() % 3);
+    long long mostFrequent = 0;
+    for (const string& d : documents) {
+        for (size_t i = 0; i + minLen <= d.size(); i++) {
+            mostFrequent = max(mostFrequent, occurrencesOf(documents, d.substr(i, minLen)));
+        }
+    }
+    // Only substrings that occur more than once are reported
+    vector<GeneralizedSuffixAutomaton::Match> top = automaton.topRepeated(5, minLen);
+    CHECK(top.empty() == (mostFrequent < 2));
+    if (!top.empty()) CHECK(top[0].occurrences == mostFrequent);
+    for (size_t i = 0; i < top.size(); i++) {
+        CHECK(static_cast<int>(top[i].substring.size()) >= minLen && top[i].occurrences > 1);
+        CHECK(top[i].occurrences == occurrencesOf(documents, top[i].substring));
+        CHECK(top[i].documents == documentsContaining(documents, top[i].substring));
+        if (i > 0) CHECK(top[i - 1].occurrences >= top[i].occurrences);
+        // Right-maximal: no one-character extension keeps every occurrence
+        for (char c = 'a'; c <= 'c'; c++) {
+            CHECK(occurrencesOf(documents, top[i].substring + c) != top[i].occurrences);
+        }
+        for (size_t j = 0; j < top.size(); j++) {
+            bool extends = j != i && top[j].substring.compare(0, top[i].substring.size(), top[i].substring) == 0;
+            CHECK(!(extends && top[j].occurrences == top[i].occurrences));
+        }
+    }
+}
+
+int main() {
+    mt19937 rng(7);
+    for (int iteration = 0; iteration < 1500; iteration++) {
+        vector<string> documents(1 + rng() % 6);
+        for (string& d : documents) {
+            size_t length = 1 + rng() % 14;
+            for (size_t i = 0; i < length; i++) d += static_cast<char>('a' + rng() % 3);
+        }
+        checkCorpus(documents);
+    }
+    checkCorpus({"banana", "ananas", "bandana"});
+    return testResult("suffix_automaton");
+}
@@ -0,0 +1,36 @@
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "Two_Sum.h"
+#include "test_check.h"
+
+using namespace std;
+
+int main() {
+    mt19937 rng(13);
+    for (int iteration = 0; iteration < 2000; iteration++) {
+        vector<int> arr(rng() % 40);
+        for (int& v : arr) v = static_cast<int>(rng() % 41) - 20;
+        int target = static_cast<int>(rng() % 41) - 20;
+
+        // The pair whose second index is smallest, as twoSum scans left to right
+        pair<int, int> expected = {-1, -1};
+        for (int j = 0; j < static_cast<int>(arr.size()) && expected.first < 0; j++) {
+            for (int i = 0; i < j; i++) {
+                if (arr[i] + arr[j] == target) expected = {i, j};
+            }
+        }
+        pair<int, int> found = twoSum(arr, target);
+        if (expected.first < 0) {
+            CHECK(found == expected);
+        } else {
+            CHECK(found.second == expected.second && found.first < found.second &&
+                  arr[found.first] + arr[found.second] == target);
+        }
+    }
+
+    CHECK(isValidInput("1, 2 3,-4") && !isValidInput("1,,2") && !isValidInput("a b"));
+    CHECK(parseInput("1, 2 3,-4") == vector<int>({1, 2, 3, -4}));
+    return testResult("two_sum");
+}